@@ -0,0 +1,294 @@
+#include "Timers.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Timers;
+
+namespace {
+
+constexpr int64_t MIN_TIMERS = 1000;
+constexpr int64_t MAX_TIMERS = 10000000;
+
+/**
+ * @brief - Create timers with random deadlines within an hour from now
+ */
+std::vector<std::shared_ptr<Timer>> makeTimers(size_t count, Clock::time_point now) {
+    std::mt19937_64 generator{count};
+    std::uniform_int_distribution<int64_t> offsetMilliseconds{1, 60 * 60 * 1000};
+    std::vector<std::shared_ptr<Timer>> timers{};
+    timers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto timer = std::make_shared<OneShotTimer>([]() {});
+        timer->setExpirationTimePoint(now + std::chrono::milliseconds(offsetMilliseconds(generator)));
+        timers.emplace_back(std::move(timer));
+    }
+    return timers;
+}
+
+/**
+ * @brief - Arguments of cache benchmarks, every backend with timer counts from MIN_TIMERS to MAX_TIMERS
+ */
+void cacheArguments(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"backend", "timers"});
+    for (auto backend : {CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP}) {
+        for (auto count = MIN_TIMERS; count <= MAX_TIMERS; count *= 10) {
+            benchmark->Args({backend, count});
+        }
+    }
+    benchmark->Unit(benchmark::kMillisecond);
+}
+
+} // namespace
+
+static void BM_CacheRegister(benchmark::State& state) {
+    auto backend = static_cast<CacheBackend>(state.range(0));
+    auto count = static_cast<size_t>(state.range(1));
+    auto timers = makeTimers(count, Clock::now());
+    for (auto _ : state) {
+        TimersCache timersCache{backend};
+        for (const auto& timer : timers) {
+            timersCache.registerTimer(timer);
+        }
+        benchmark::DoNotOptimize(timersCache.size());
+        state.PauseTiming();
+        for (const auto& timer : timers) {
+            timersCache.deleteTimer(timer);
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_CacheRegister)->Apply(cacheArguments);
+
+static void BM_CacheRegisterBatch(benchmark::State& state) {
+    auto backend = static_cast<CacheBackend>(state.range(0));
+    auto count = static_cast<size_t>(state.range(1));
+    auto timers = makeTimers(count, Clock::now());
+    for (auto _ : state) {
+        TimersCache timersCache{backend};
+        timersCache.registerTimers(timers);
+        benchmark::DoNotOptimize(timersCache.size());
+        state.PauseTiming();
+        timersCache.deleteTimers(timers);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_CacheRegisterBatch)->Apply(cacheArguments);
+
+static void BM_CacheDelete(benchmark::State& state) {
+    auto backend = static_cast<CacheBackend>(state.range(0));
+    auto count = static_cast<size_t>(state.range(1));
+    auto timers = makeTimers(count, Clock::now());
+    TimersCache timersCache{backend};
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (const auto& timer : timers) {
+            timersCache.registerTimer(timer);
+        }
+        state.ResumeTiming();
+        for (const auto& timer : timers) {
+            timersCache.deleteTimer(timer);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_CacheDelete)->Apply(cacheArguments);
+
+static void BM_CacheExpire(benchmark::State& state) {
+    auto backend = static_cast<CacheBackend>(state.range(0));
+    auto count = static_cast<size_t>(state.range(1));
+    auto timers = makeTimers(count, Clock::now());
+    TimersCache timersCache{backend};
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    expiredTimers.reserve(count);
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (const auto& timer : timers) {
+            timersCache.registerTimer(timer);
+        }
+        state.ResumeTiming();
+        // The same passes as timers thread takes, one per distinct deadline
+        while (auto nextExpirationTimePoint = timersCache.getNextExpirationTimePoint()) {
+            timersCache.extractExpiredTimers(*nextExpirationTimePoint, expiredTimers);
+        }
+        state.PauseTiming();
+        expiredTimers.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_CacheExpire)->Apply(cacheArguments);
+
+static void BM_CacheLongThenShort(benchmark::State& state) {
+    auto backend = static_cast<CacheBackend>(state.range(0));
+    auto count = static_cast<size_t>(state.range(1));
+    TimersCache timersCache{backend};
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    expiredTimers.reserve(count);
+    // Timers are extracted ahead of time, so every iteration starts after deadlines of previous one like runner would
+    auto now = Clock::now();
+    for (auto _ : state) {
+        state.PauseTiming();
+        now = std::max(Clock::now(), now + std::chrono::hours(1) + std::chrono::milliseconds(1));
+        auto longTimer = std::make_shared<OneShotTimer>([]() {});
+        longTimer->setExpirationTimePoint(now + std::chrono::hours(2));
+        std::vector<std::shared_ptr<Timer>> timers{};
+        for (size_t i = 0; i < count; ++i) {
+            auto timer = std::make_shared<OneShotTimer>([]() {});
+            timer->setExpirationTimePoint(now + std::chrono::milliseconds(1 + i % (60 * 60 * 1000)));
+            timers.emplace_back(std::move(timer));
+        }
+        timersCache.registerTimer(longTimer);
+        state.ResumeTiming();
+        // Timers registered while long one is pending must not pile up in single slot
+        for (const auto& timer : timers) {
+            timersCache.registerTimer(timer);
+        }
+        while (timersCache.size() > 1) {
+            timersCache.extractExpiredTimers(*timersCache.getNextExpirationTimePoint(), expiredTimers);
+        }
+        state.PauseTiming();
+        timersCache.deleteTimer(longTimer);
+        expiredTimers.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_CacheLongThenShort)->Apply(cacheArguments);
+
+static void BM_CacheSameDeadlineBurst(benchmark::State& state) {
+    auto backend = static_cast<CacheBackend>(state.range(0));
+    auto count = static_cast<size_t>(state.range(1));
+    auto deadline = Clock::now() + std::chrono::seconds(1);
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (size_t i = 0; i < count; ++i) {
+        auto timer = std::make_shared<OneShotTimer>([]() {});
+        timer->setExpirationTimePoint(deadline);
+        timers.emplace_back(std::move(timer));
+    }
+    TimersCache timersCache{backend};
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    for (auto _ : state) {
+        for (const auto& timer : timers) {
+            timersCache.registerTimer(timer);
+        }
+        benchmark::DoNotOptimize(timersCache.getTimersExpiringAt(*timersCache.getNextExpirationTimePoint()));
+        timersCache.extractExpiredTimers(deadline, expiredTimers);
+        expiredTimers.clear();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_CacheSameDeadlineBurst)->Apply(cacheArguments);
+
+static void BM_SlabStartStop(benchmark::State& state) {
+    auto count = static_cast<size_t>(state.range(0));
+    TimersSlab slab{};
+    SlabSchedule schedule{slab};
+    std::vector<TimerId> timerIds{};
+    for (size_t i = 0; i < count; ++i) {
+        timerIds.emplace_back(slab.create([](void*) {}, nullptr, std::chrono::seconds(1), false));
+    }
+    auto now = Clock::now();
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            schedule.arm(timerIds[i], now + std::chrono::milliseconds(i % 3600000));
+        }
+        for (const auto& timerId : timerIds) {
+            schedule.disarm(timerId);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count * 2));
+}
+BENCHMARK(BM_SlabStartStop)->RangeMultiplier(10)->Range(MIN_TIMERS, MAX_TIMERS)->Unit(benchmark::kMillisecond);
+
+static void BM_TimerRearm(benchmark::State& state) {
+    auto lazy = state.range(0) != 0;
+    TimersEngine engine{CacheBackend::HEAP};
+    auto timer = std::make_shared<OneShotTimer>([]() {}, std::chrono::seconds(30));
+    engine.addTimer(timer);
+    engine.poll();
+    for (auto _ : state) {
+        // Lazy extension is single atomic store, restart goes through actions queue and storage of cache
+        if (lazy) {
+            timer->extend();
+        } else {
+            engine.restartTimer(timer);
+            engine.poll();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_TimerRearm)->ArgName("lazy")->Arg(0)->Arg(1);
+
+static void BM_EnginePoll(benchmark::State& state) {
+    auto count = static_cast<size_t>(state.range(0));
+    Clock::setSource(ClockSource::VIRTUAL);
+    TimersEngine engine{CacheBackend::HEAP};
+    for (size_t i = 0; i < count; ++i) {
+        engine.addTimer(std::make_shared<RepeatableTimer>([]() {}, std::chrono::milliseconds(1 + i % 1000)));
+    }
+    engine.poll(Clock::now());
+    size_t executed{};
+    for (auto _ : state) {
+        Clock::advanceTo(*engine.nextDeadline());
+        executed += engine.poll(Clock::now());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(executed));
+    Clock::setSource(ClockSource::STEADY);
+}
+BENCHMARK(BM_EnginePoll)->RangeMultiplier(10)->Range(MIN_TIMERS, 1000000);
+
+static void BM_TimerStartStop(benchmark::State& state) {
+    if (state.thread_index() == 0 && !TimersManager::isInitialized()) {
+        TimersManager::initialize();
+        TimersManager::start();
+    }
+    auto timer = std::make_shared<OneShotTimer>([]() {}, std::chrono::hours(1));
+    for (auto _ : state) {
+        // Both calls block on timer state until timers thread applied their action
+        timer->start();
+        timer->stop();
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_TimerStartStop)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief - Actions queue shared by producer threads of push contention benchmark
+ */
+struct QueueFixture {
+    ThreadControl threadControl{};
+    TimersCache timersCache{CacheBackend::HEAP};
+    TimersSlab slab{};
+    SlabSchedule slabSchedule{slab};
+    ActionsQueue actionsQueue{threadControl, timersCache, ActionsQueue::DEFAULT_CAPACITY, &slabSchedule};
+};
+
+static void BM_ActionsQueuePush(benchmark::State& state) {
+    static QueueFixture* fixture{nullptr};
+    if (state.thread_index() == 0) {
+        fixture = new QueueFixture{};
+    }
+    constexpr int64_t BATCH = 64;
+    for (auto _ : state) {
+        // Actions on stale handle keep consumer cheap, so producers contention is measured
+        for (int64_t i = 0; i < BATCH; ++i) {
+            fixture->actionsQueue.push(TIMER_ACTION::STOP_HANDLE, TimerId{}, {});
+        }
+        if (state.thread_index() == 0) {
+            fixture->actionsQueue.process();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+    if (state.thread_index() == 0) {
+        fixture->actionsQueue.process();
+        delete fixture;
+    }
+}
+BENCHMARK(BM_ActionsQueuePush)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,13 @@
+#pragma once
+#include "Timers.hpp"
+
+/**
+ * @brief - Switch clock source for scope of test, previous source is restored also when assertion fails
+ */
+struct ClockSourceGuard {
+    Timers::ClockSource previous{Timers::Clock::getSource()};
+    explicit ClockSourceGuard(Timers::ClockSource clockSource) { Timers::Clock::setSource(clockSource); }
+    ~ClockSourceGuard() { Timers::Clock::setSource(previous); }
+    ClockSourceGuard(const ClockSourceGuard&) = delete;
+    ClockSourceGuard& operator=(const ClockSourceGuard&) = delete;
+};
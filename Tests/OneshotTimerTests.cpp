@@ -29,7 +29,7 @@ TEST_CASE("One shot timer creation test", "[OneShotTimers") {
     }
     SECTION("Functor callback") { timer = makeOneShotTimer(Callback(timerValue)); }
     SECTION("Callback with expiration time point") {
-        auto firstExpiration = std::chrono::high_resolution_clock::now() + std::chrono::seconds(5);
+        auto firstExpiration = Clock::now() + std::chrono::seconds(5);
 
         SECTION("Lambda callback") {
             timer = makeOneShotTimer([&timerValue]() { timerValue = EXPECTED_TIMER_VALUE; }, firstExpiration);
@@ -49,10 +49,11 @@ TEST_CASE("One shot timer creation test", "[OneShotTimers") {
     timer->setPriority(5);
     REQUIRE(timer->getPriority() == 5);
 
-    auto expiration = std::chrono::high_resolution_clock::now() + std::chrono::seconds(5);
+    auto expiration = Clock::now() + std::chrono::seconds(5);
     timer->setExpirationTimePoint(expiration);
     REQUIRE(timer->getExpirationTimePoint() == expiration);
 
     // It will throw as timer manager is not initialized
     REQUIRE_THROWS(timer->start());
+    REQUIRE(timer->getState() == Timer::IDLE);
 }
\ No newline at end of file
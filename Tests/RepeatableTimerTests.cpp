@@ -1,4 +1,5 @@
 #include "Timers.hpp"
+#include "ClockSourceGuard.hpp"
 #include <catch2/catch.hpp>
 #include <iostream>
 
@@ -48,8 +49,55 @@ TEST_CASE( "Repeatable timer creation test", "[RepeatableTimers" ) {
     REQUIRE(timer->getPriority() == 5);
 
     // Expiration set
-    std::chrono::high_resolution_clock::time_point expiration = std::chrono::high_resolution_clock::now() + std::chrono::seconds(5);
+    Clock::time_point expiration = Clock::now() + std::chrono::seconds(5);
     timer->setExpirationTimePoint(expiration);
     REQUIRE(timer->getExpirationTimePoint() == expiration);
 
-}
\ No newline at end of file
+}
+
+TEST_CASE("Repeatable timer catch up policy test", "[RepeatableTimers]") {
+    ClockSourceGuard clockSourceGuard{ClockSource::VIRTUAL};
+    auto policy = GENERATE(RepeatableTimer::BURST, RepeatableTimer::SKIP, RepeatableTimer::COALESCE);
+    TimersEngine engine{CacheBackend::HEAP};
+    uint32_t executions{};
+    auto timer = std::make_shared<RepeatableTimer>([&executions]() { executions++; }, std::chrono::seconds(1));
+    timer->setCatchUpPolicy(policy);
+    auto start = timer->getExpirationTimePoint() - timer->getDuration();
+    engine.addTimer(timer);
+
+    // Timers thread stalled for three and half periods
+    Clock::advanceTo(start + std::chrono::milliseconds(3500));
+    while (engine.poll(Clock::now()) > 0) {
+    }
+    // Next expiration stays on grid of start time point, without drift
+    REQUIRE(timer->getExpirationTimePoint() == start + std::chrono::seconds(4));
+    switch (policy) {
+    case RepeatableTimer::BURST:
+        REQUIRE(executions == 3);
+        REQUIRE(timer->getExpirationsCount() == 3);
+        break;
+    case RepeatableTimer::SKIP:
+        REQUIRE(executions == 1);
+        REQUIRE(timer->getExpirationsCount() == 1);
+        break;
+    case RepeatableTimer::COALESCE:
+        REQUIRE(executions == 1);
+        REQUIRE(timer->getExpirationsCount() == 3);
+        REQUIRE(timer->getLastCoalescedCount() == 3);
+        break;
+    }
+}
+
+TEST_CASE("Repeatable timer fixed delay test", "[RepeatableTimers]") {
+    ClockSourceGuard clockSourceGuard{ClockSource::VIRTUAL};
+    TimersEngine engine{CacheBackend::HEAP};
+    // Callback takes quarter of period, next period starts after it completes
+    auto timer = std::make_shared<RepeatableTimer>([]() { Clock::advance(std::chrono::milliseconds(250)); }, std::chrono::seconds(1));
+    timer->setScheduleMode(RepeatableTimer::FIXED_DELAY);
+    engine.addTimer(timer);
+
+    Clock::advanceTo(timer->getExpirationTimePoint());
+    REQUIRE(engine.poll(Clock::now()) == 1);
+    REQUIRE(timer->getExpirationTimePoint() == Clock::now() + std::chrono::seconds(1));
+    REQUIRE(timer->getExpirationsCount() == 1);
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "Timers.hpp"
+#include <iostream>
 
 class TestLogger : public Timers::Logger {
     void operator()(Level level, std::string_view message) noexcept override {
@@ -0,0 +1,61 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <iostream>
+
+using namespace Timers;
+
+TEST_CASE("ActionsQueue order test", "[ActionsQueue") {
+    ThreadControl threadControl{};
+    TimersCache timersCache{CacheBackend::HEAP};
+    ActionsQueue actionsQueue{threadControl, timersCache, 2};
+
+    auto timer = makeOneShotTimer([]() {}, std::chrono::seconds(1));
+    std::vector<uint8_t> completedActions{};
+    auto callback = [&completedActions](uint8_t retCode, bool) { completedActions.emplace_back(retCode); };
+
+    REQUIRE_FALSE(actionsQueue.hasPendingActions());
+    REQUIRE(actionsQueue.push(TIMER_ACTION::START, timer, callback));
+    REQUIRE_FALSE(actionsQueue.push(TIMER_ACTION::STOP, timer, callback));
+    // Above capacity, nodes are allocated on heap
+    REQUIRE_FALSE(actionsQueue.push(TIMER_ACTION::START, timer, callback));
+    REQUIRE(actionsQueue.hasPendingActions());
+
+    actionsQueue.process();
+    REQUIRE_FALSE(actionsQueue.hasPendingActions());
+    REQUIRE(completedActions == std::vector<uint8_t>{TIMER_ACTION::START, TIMER_ACTION::STOP, TIMER_ACTION::START});
+    REQUIRE(timersCache.size() == 1);
+}
+
+TEST_CASE("ActionsQueue multiple producers test", "[ActionsQueue") {
+    constexpr size_t PRODUCERS_COUNT = 4;
+    constexpr size_t TIMERS_PER_PRODUCER = 5000;
+
+    ThreadControl threadControl{};
+    TimersCache timersCache{CacheBackend::HEAP};
+    ActionsQueue actionsQueue{threadControl, timersCache, 64};
+
+    std::atomic<size_t> producersFinished{};
+    std::vector<std::thread> producers{};
+    for (size_t i = 0; i < PRODUCERS_COUNT; ++i) {
+        producers.emplace_back([&]() {
+            for (size_t j = 0; j < TIMERS_PER_PRODUCER; ++j) {
+                auto timer = makeOneShotTimer([]() {}, std::chrono::seconds(1));
+                actionsQueue.push(TIMER_ACTION::START, timer, nullptr);
+                // Stopped timer is started again, so order of actions of single producer matters
+                if (j % 2 == 0) {
+                    actionsQueue.push(TIMER_ACTION::STOP, timer, nullptr);
+                    actionsQueue.push(TIMER_ACTION::START, timer, nullptr);
+                }
+            }
+            producersFinished++;
+        });
+    }
+
+    while (producersFinished != PRODUCERS_COUNT || actionsQueue.hasPendingActions()) {
+        actionsQueue.process();
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    REQUIRE(timersCache.size() == PRODUCERS_COUNT * TIMERS_PER_PRODUCER);
+}
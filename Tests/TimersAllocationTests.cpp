@@ -0,0 +1,95 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+using namespace Timers;
+
+namespace {
+
+/**
+ * @brief - Number of allocations made through global operator new
+ */
+std::atomic<size_t> globalAllocations{};
+
+/**
+ * @brief - Memory resource counting allocations, which it forwards to upstream resource
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::atomic<size_t> allocations{};
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+} // namespace
+
+void* operator new(size_t size) {
+    globalAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+
+TEST_CASE("TimersEngine steady state allocation test", "[TimersAllocation]") {
+    constexpr size_t TIMERS_COUNT = 64;
+    constexpr auto DURATION = std::chrono::milliseconds(10);
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    CountingResource upstream{};
+    TimersEngine engine{backend, ActionsQueue::DEFAULT_CAPACITY, false, &upstream};
+
+    size_t expirations{};
+    std::vector<std::shared_ptr<OneShotTimer>> timers{};
+    for (size_t i = 0; i < TIMERS_COUNT; ++i) {
+        timers.emplace_back(std::make_shared<OneShotTimer>([&expirations]() { ++expirations; }, DURATION));
+        // Timers spread over priority lanes, and some are coalesced within their slack
+        timers.back()->setPriority(static_cast<uint32_t>(i % TimersCache::PRIORITY_LANES));
+        timers.back()->setSlack(i % 2 == 0 ? std::chrono::milliseconds(1) : Clock::duration::zero());
+    }
+
+    auto cycle = [&]() {
+        for (const auto& timer : timers) {
+            engine.addTimer(timer);
+        }
+        engine.poll();
+        engine.poll(Clock::now() + 2 * DURATION);
+        for (const auto& timer : timers) {
+            engine.restartTimer(timer);
+        }
+        engine.poll();
+        engine.poll(Clock::now() + 2 * DURATION);
+    };
+
+    // Warm up fills pool of cache and reused vectors, all of them taken from upstream resource
+    cycle();
+    cycle();
+    REQUIRE(upstream.allocations > 0);
+    REQUIRE(expirations == 4 * TIMERS_COUNT);
+
+    auto upstreamAllocations = upstream.allocations.load();
+    auto allocations = globalAllocations.load();
+    for (size_t i = 0; i < 16; ++i) {
+        cycle();
+    }
+    auto steadyStateAllocations = globalAllocations.load() - allocations;
+    REQUIRE(steadyStateAllocations == 0);
+    REQUIRE(upstream.allocations == upstreamAllocations);
+    REQUIRE(expirations == 36 * TIMERS_COUNT);
+    REQUIRE(engine.size() == 0);
+}
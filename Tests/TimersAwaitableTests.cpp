@@ -0,0 +1,101 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <future>
+#include <iostream>
+
+using namespace Timers;
+
+namespace {
+
+/**
+ * @brief - Coroutine started eagerly, nobody waits for its result
+ */
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+struct Result {
+    bool expired{};
+    std::thread::id resumedOn{};
+    Clock::time_point resumedAt{};
+};
+
+DetachedTask sleepFor(Clock::duration duration, std::stop_token stopToken, CoroutineExecutor* executor,
+                      std::promise<Result>& result) {
+    auto expired = co_await Timers::sleep_for(duration, std::move(stopToken), executor);
+    result.set_value(Result{expired, std::this_thread::get_id(), Clock::now()});
+}
+
+/**
+ * @brief - Executor resuming single posted coroutine on its worker thread
+ */
+class ThreadExecutor : public CoroutineExecutor {
+public:
+    std::promise<std::coroutine_handle<>> posted{};
+    std::thread worker{[this, handle = posted.get_future()]() mutable { handle.get().resume(); }};
+    void post(std::coroutine_handle<> handle) override { posted.set_value(handle); }
+};
+
+void startManager() {
+    if (!TimersManager::isInitialized()) {
+        TimersManager::initialize();
+        TimersManager::start();
+    }
+}
+
+} // namespace
+
+TEST_CASE("Coroutine sleep test", "[TimersAwaitable]") {
+    startManager();
+    std::promise<Result> result{};
+    auto future = result.get_future();
+    auto start = Clock::now();
+    sleepFor(std::chrono::milliseconds(50), {}, nullptr, result);
+
+    REQUIRE(future.wait_for(std::chrono::seconds(2)) == std::future_status::ready);
+    auto value = future.get();
+    REQUIRE(value.expired);
+    REQUIRE(value.resumedAt - start >= std::chrono::milliseconds(50));
+    // Coroutine is resumed directly on timers thread
+    REQUIRE(value.resumedOn != std::this_thread::get_id());
+}
+
+TEST_CASE("Coroutine sleep cancellation test", "[TimersAwaitable]") {
+    startManager();
+    std::stop_source stopSource{};
+    std::promise<Result> result{};
+    auto future = result.get_future();
+    sleepFor(std::chrono::seconds(10), stopSource.get_token(), nullptr, result);
+    REQUIRE(future.wait_for(std::chrono::milliseconds(20)) == std::future_status::timeout);
+
+    stopSource.request_stop();
+    REQUIRE(future.wait_for(std::chrono::seconds(1)) == std::future_status::ready);
+    REQUIRE_FALSE(future.get().expired);
+
+    // Already requested stop does not suspend coroutine at all
+    std::promise<Result> stoppedResult{};
+    auto stoppedFuture = stoppedResult.get_future();
+    sleepFor(std::chrono::seconds(10), stopSource.get_token(), nullptr, stoppedResult);
+    REQUIRE(stoppedFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    REQUIRE(stoppedFuture.get().resumedOn == std::this_thread::get_id());
+}
+
+TEST_CASE("Coroutine sleep executor test", "[TimersAwaitable]") {
+    startManager();
+    ThreadExecutor executor{};
+    std::promise<Result> result{};
+    auto future = result.get_future();
+    sleepFor(std::chrono::milliseconds(10), {}, &executor, result);
+
+    REQUIRE(future.wait_for(std::chrono::seconds(2)) == std::future_status::ready);
+    auto value = future.get();
+    REQUIRE(value.expired);
+    REQUIRE(value.resumedOn == executor.worker.get_id());
+    executor.worker.join();
+}
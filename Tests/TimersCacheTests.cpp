@@ -1,7 +1,9 @@
 #include "Timers.hpp"
+#include <algorithm>
 #include <catch2/catch.hpp>
 #include <chrono>
 #include <iostream>
+#include <thread>
 
 using namespace Timers;
 
@@ -12,9 +14,10 @@ public:
 };
 
 TEST_CASE("TimersCache test", "[TimersCache") {
-    TimersCache timersCache{};
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
 
-    std::chrono::high_resolution_clock::time_point now = std::chrono::high_resolution_clock::now();
+    Clock::time_point now = Clock::now();
 
     std::shared_ptr<Timer> timer_1 = std::make_shared<OneShotTimer>(Callback());
     timer_1->setExpirationTimePoint(now);
@@ -40,4 +43,353 @@ TEST_CASE("TimersCache test", "[TimersCache") {
     REQUIRE(timersCache.size() == 1);
     timersCache.deleteTimer(timer_2);
     REQUIRE(timersCache.size() == 0);
-}
\ No newline at end of file
+}
+
+TEST_CASE("TimersCache expiration order test", "[TimersCache") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
+
+    Clock::time_point now = Clock::now();
+
+    // Deadlines spread over all levels of timing wheel, including overflow
+    std::vector<Clock::duration> offsets{
+        std::chrono::hours(24 * 100), std::chrono::microseconds(10), std::chrono::milliseconds(300),
+        std::chrono::seconds(70),     std::chrono::hours(24 * 10),   std::chrono::milliseconds(5),
+        std::chrono::milliseconds(5), std::chrono::seconds(-1),      std::chrono::hours(2)};
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (auto offset : offsets) {
+        auto timer = std::make_shared<OneShotTimer>(Callback());
+        timer->setExpirationTimePoint(now + offset);
+        timersCache.registerTimer(timer);
+        timers.emplace_back(timer);
+    }
+    REQUIRE(timersCache.size() == timers.size());
+
+    // Timer removed from the middle of container is never reported
+    timersCache.deleteTimer(timers[3]);
+    timersCache.deleteTimer(timers[3]);
+    REQUIRE(timersCache.size() == timers.size() - 1);
+
+    Clock::time_point previous = Clock::time_point::min();
+    size_t expiredCount{};
+    while (auto nextExpirationTimePoint = timersCache.getNextExpirationTimePoint()) {
+        REQUIRE(*nextExpirationTimePoint >= previous);
+        previous = *nextExpirationTimePoint;
+
+        auto expiredTimers = timersCache.getTimersExpiringAt(*nextExpirationTimePoint);
+        REQUIRE_FALSE(expiredTimers.empty());
+        for (const auto& expiredTimer : expiredTimers) {
+            REQUIRE(expiredTimer != timers[3]);
+            REQUIRE(expiredTimer->getExpirationTimePoint() == *nextExpirationTimePoint);
+            timersCache.deleteTimer(expiredTimer);
+            ++expiredCount;
+        }
+
+        // Timer registered behind already processed deadlines is still found
+        if (expiredCount == 2) {
+            auto lateTimer = std::make_shared<OneShotTimer>(Callback());
+            lateTimer->setExpirationTimePoint(now - std::chrono::seconds(5));
+            timersCache.registerTimer(lateTimer);
+            REQUIRE(timersCache.getNextExpirationTimePoint() == lateTimer->getExpirationTimePoint());
+            previous = lateTimer->getExpirationTimePoint();
+        }
+    }
+    REQUIRE(expiredCount == timers.size());  // One deleted, one registered late
+    REQUIRE(timersCache.size() == 0);
+}
+
+TEST_CASE("TimersCache same deadline burst test", "[TimersCache") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
+
+    constexpr size_t TIMERS_COUNT = 1000;
+    auto deadline = Clock::now() + std::chrono::seconds(1);
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (size_t i = 0; i < TIMERS_COUNT; ++i) {
+        auto timer = std::make_shared<OneShotTimer>(Callback());
+        timer->setExpirationTimePoint(deadline);
+        timersCache.registerTimer(timer);
+        timers.emplace_back(timer);
+    }
+
+    // Every second timer is cancelled, remaining ones can not be registered twice
+    for (size_t i = 0; i < TIMERS_COUNT; i += 2) {
+        timersCache.deleteTimer(timers[i]);
+    }
+    for (size_t i = 1; i < TIMERS_COUNT; i += 2) {
+        REQUIRE_THROWS(timersCache.registerTimer(timers[i]));
+    }
+    REQUIRE(timersCache.size() == TIMERS_COUNT / 2);
+    REQUIRE(timersCache.getNextExpirationTimePoint() == deadline);
+    REQUIRE(timersCache.getTimersExpiringAt(deadline).size() == TIMERS_COUNT / 2);
+
+    // Cancelled timer may be registered again
+    timersCache.registerTimer(timers[0]);
+    REQUIRE(timersCache.size() == TIMERS_COUNT / 2 + 1);
+}
+
+TEST_CASE("TimersCache expired timers extraction test", "[TimersCache") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
+
+    Clock::time_point now = Clock::now();
+
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (auto offset : {std::chrono::milliseconds(-20), std::chrono::milliseconds(-10), std::chrono::milliseconds(-10),
+                        std::chrono::milliseconds(0), std::chrono::milliseconds(10), std::chrono::milliseconds(500)}) {
+        auto timer = std::make_shared<OneShotTimer>(Callback());
+        timer->setExpirationTimePoint(now + offset);
+        timersCache.registerTimer(timer);
+        timers.emplace_back(timer);
+    }
+    timers[2]->setPriority(1);
+    timers[3]->setPriority(7);
+
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    timersCache.extractExpiredTimers(now, expiredTimers);
+    REQUIRE(expiredTimers.size() == 4);
+    REQUIRE(timersCache.size() == 2);
+    // Higher priority lane goes first among all expired timers, lane keeps order of expiration
+    REQUIRE(expiredTimers[0] == timers[3]);
+    REQUIRE(expiredTimers[1] == timers[2]);
+    REQUIRE(expiredTimers[2] == timers[0]);
+    REQUIRE(expiredTimers[3] == timers[1]);
+
+    expiredTimers.clear();
+    timersCache.extractExpiredTimers(now, expiredTimers);
+    REQUIRE(expiredTimers.empty());
+    REQUIRE(timersCache.getNextExpirationTimePoint() == now + std::chrono::milliseconds(10));
+
+    timersCache.extractExpiredTimers(now + std::chrono::seconds(1), expiredTimers);
+    REQUIRE(expiredTimers.size() == 2);
+    REQUIRE(timersCache.size() == 0);
+}
+
+TEST_CASE("TimersCache checked out timers test", "[TimersCache") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
+
+    std::shared_ptr<Timer> timer = std::make_shared<RepeatableTimer>([]() {}, std::chrono::seconds(1));
+    timer->restart();
+    timersCache.registerTimer(timer);
+
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    timersCache.extractExpiredTimers(timer->getExpirationTimePoint(), expiredTimers);
+    REQUIRE(expiredTimers.size() == 1);
+    REQUIRE(timersCache.size() == 0);
+
+    // Timer which should keep ticking comes back to cache after execution
+    timersCache.checkOutTimer(timer);
+    timersCache.checkInTimer(timer, true);
+    REQUIRE(timersCache.size() == 1);
+
+    // Timer deleted while it was executed does not come back
+    expiredTimers.clear();
+    timersCache.extractExpiredTimers(timer->getExpirationTimePoint(), expiredTimers);
+    timersCache.checkOutTimer(timer);
+    timersCache.deleteTimer(timer);
+    timersCache.checkInTimer(timer, true);
+    REQUIRE(timersCache.size() == 0);
+
+    // Timer which should not keep ticking does not come back
+    timersCache.registerTimer(timer);
+    expiredTimers.clear();
+    timersCache.extractExpiredTimers(timer->getExpirationTimePoint(), expiredTimers);
+    timersCache.checkOutTimer(timer);
+    timersCache.checkInTimer(timer, false);
+    REQUIRE(timersCache.size() == 0);
+}
+
+TEST_CASE("TimersCache slack coalescing test", "[TimersCache") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
+
+    Clock::time_point now = Clock::now();
+
+    auto tolerantTimer = std::make_shared<OneShotTimer>(Callback());
+    tolerantTimer->setExpirationTimePoint(now + std::chrono::milliseconds(10));
+    tolerantTimer->setSlack(std::chrono::milliseconds(5));
+    auto coalescedTimer = std::make_shared<OneShotTimer>(Callback());
+    coalescedTimer->setExpirationTimePoint(now + std::chrono::milliseconds(12));
+    coalescedTimer->setSlack(std::chrono::milliseconds(10));
+    auto strictTimer = std::make_shared<OneShotTimer>(Callback());
+    strictTimer->setExpirationTimePoint(now + std::chrono::milliseconds(30));
+    timersCache.registerTimer(tolerantTimer);
+    timersCache.registerTimer(coalescedTimer);
+    timersCache.registerTimer(strictTimer);
+
+    // Wake up is delayed until first timer runs out of slack
+    auto nextExpirationTimePoint = timersCache.getNextExpirationTimePoint();
+    REQUIRE(nextExpirationTimePoint.has_value());
+    REQUIRE(*nextExpirationTimePoint == now + std::chrono::milliseconds(15));
+
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    timersCache.extractExpiredTimers(*nextExpirationTimePoint, expiredTimers);
+    REQUIRE(expiredTimers == std::vector<std::shared_ptr<Timer>>{tolerantTimer, coalescedTimer});
+    REQUIRE(timersCache.getSavedWakeUps() == 1);
+    REQUIRE(timersCache.size() == 1);
+    REQUIRE(*timersCache.getNextExpirationTimePoint() == now + std::chrono::milliseconds(30));
+}
+
+TEST_CASE("TimersCache batch registration test", "[TimersCache") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
+
+    Clock::time_point now = Clock::now();
+
+    // First batch fills empty cache, second one is smaller than cache and interleaves with registered timers
+    std::vector<std::shared_ptr<Timer>> firstBatch{};
+    for (int i = 40; i > 0; --i) {
+        auto timer = std::make_shared<OneShotTimer>(Callback());
+        timer->setExpirationTimePoint(now + std::chrono::milliseconds(2 * i));
+        firstBatch.emplace_back(timer);
+    }
+    REQUIRE(timersCache.registerTimers(firstBatch) == 40);
+
+    std::vector<std::shared_ptr<Timer>> secondBatch{};
+    for (int i = 0; i < 10; ++i) {
+        auto timer = std::make_shared<OneShotTimer>(Callback());
+        timer->setExpirationTimePoint(now + std::chrono::milliseconds(2 * i + 1));
+        secondBatch.emplace_back(timer);
+    }
+    // Already registered and repeated timers are registered once
+    secondBatch.emplace_back(firstBatch.front());
+    secondBatch.emplace_back(secondBatch.front());
+    REQUIRE(timersCache.registerTimers(secondBatch) == 10);
+    REQUIRE(timersCache.size() == 50);
+    REQUIRE(*timersCache.getNextExpirationTimePoint() == now + std::chrono::milliseconds(1));
+
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    timersCache.extractExpiredTimers(now + std::chrono::milliseconds(100), expiredTimers);
+    REQUIRE(expiredTimers.size() == 50);
+    REQUIRE(std::is_sorted(std::begin(expiredTimers), std::end(expiredTimers), [](const auto& first, const auto& second) {
+        return first->getExpirationTimePoint() < second->getExpirationTimePoint();
+    }));
+
+    REQUIRE(timersCache.registerTimers(firstBatch) == 40);
+    timersCache.deleteTimers(firstBatch);
+    REQUIRE(timersCache.size() == 0);
+
+    std::vector<std::shared_ptr<Timer>> invalidBatch{firstBatch.front(), nullptr};
+    REQUIRE_THROWS_AS(timersCache.registerTimers(invalidBatch), TimerError);
+    REQUIRE(timersCache.size() == 0);
+}
+
+TEST_CASE("TimersCache lazy cancellation and extension test", "[TimersCache") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
+
+    Clock::time_point now = Clock::now();
+
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (int i = 0; i < 4; ++i) {
+        auto timer = std::make_shared<OneShotTimer>(Callback(), std::chrono::milliseconds(10));
+        timer->setExpirationTimePoint(now + std::chrono::milliseconds(10));
+        timersCache.registerTimer(timer);
+        timers.emplace_back(timer);
+    }
+
+    // Cancelled timer is discarded, extended one is moved, extension to earlier time point is ignored
+    timers[0]->cancel();
+    timers[1]->extendTo(now + std::chrono::milliseconds(30));
+    timers[2]->extendTo(now + std::chrono::milliseconds(5));
+    REQUIRE(timersCache.size() == 4);
+
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    timersCache.extractExpiredTimers(now + std::chrono::milliseconds(10), expiredTimers);
+    REQUIRE(expiredTimers.size() == 2);
+    REQUIRE(std::find(std::begin(expiredTimers), std::end(expiredTimers), timers[2]) != std::end(expiredTimers));
+    REQUIRE(std::find(std::begin(expiredTimers), std::end(expiredTimers), timers[3]) != std::end(expiredTimers));
+    REQUIRE(timersCache.size() == 1);
+    REQUIRE(*timersCache.getNextExpirationTimePoint() == now + std::chrono::milliseconds(30));
+
+    // Extension already reached is executed in the same pass, earlier extension does not override later one
+    timers[1]->extendTo(now + std::chrono::milliseconds(35));
+    timers[1]->extendTo(now + std::chrono::milliseconds(32));
+    expiredTimers.clear();
+    timersCache.extractExpiredTimers(now + std::chrono::milliseconds(40), expiredTimers);
+    REQUIRE(expiredTimers.size() == 1);
+    REQUIRE(expiredTimers.front()->getExpirationTimePoint() == now + std::chrono::milliseconds(35));
+    REQUIRE(timersCache.size() == 0);
+
+    // Restart registers timer again, compaction removes cancelled one before its expiration
+    for (const auto& timer : timers) {
+        timersCache.restartTimer(timer);
+    }
+    REQUIRE(timersCache.size() == 4);
+    timers[0]->cancel();
+    timers[3]->cancel();
+    timersCache.setCompactionInterval(std::chrono::milliseconds(100));
+    REQUIRE(timersCache.compact(Clock::now() + std::chrono::seconds(1)) == 2);
+    REQUIRE(timersCache.compact(Clock::now() + std::chrono::seconds(2)) == 0);
+    REQUIRE(timersCache.size() == 2);
+
+    // Tombstone discarded at expiration or by compaction does not prevent registering timer again
+    timers[1]->cancel();
+    expiredTimers.clear();
+    timersCache.extractExpiredTimers(Clock::now() + std::chrono::seconds(1), expiredTimers);
+    REQUIRE(expiredTimers.size() == 1);
+    REQUIRE(timersCache.size() == 0);
+    for (const auto& timer : {timers[0], timers[1]}) {
+        timersCache.restartTimer(timer);
+        REQUIRE_FALSE(timer->isCancelled());
+    }
+    expiredTimers.clear();
+    timersCache.extractExpiredTimers(Clock::now() + std::chrono::seconds(1), expiredTimers);
+    REQUIRE(expiredTimers.size() == 2);
+}
+
+TEST_CASE("Timer concurrent extension test", "[TimersCache") {
+    auto timer = std::make_shared<OneShotTimer>(Callback(), std::chrono::milliseconds(10));
+    auto base = Clock::now();
+    std::vector<std::thread> extenders{};
+    for (int thread = 0; thread < 4; ++thread) {
+        extenders.emplace_back([&timer, base, thread]() {
+            for (int i = 0; i < 1000; ++i) {
+                timer->extendTo(base + std::chrono::microseconds(i * 4 + thread));
+            }
+        });
+    }
+    for (auto& extender : extenders) {
+        extender.join();
+    }
+    TimersCache timersCache{};
+    timer->setExpirationTimePoint(base);
+    timersCache.registerTimer(timer);
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    timersCache.extractExpiredTimers(base, expiredTimers);
+    // Latest of all requested extensions wins, regardless of order in which threads stored them
+    REQUIRE(*timersCache.getNextExpirationTimePoint() == base + std::chrono::microseconds(3999));
+}
+
+TEST_CASE("TimersCache long timer followed by short timers test", "[TimersCache") {
+    constexpr int SHORT_TIMERS_COUNT = 2000;
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersCache timersCache{backend};
+    auto now = Clock::now();
+
+    auto longTimer = std::make_shared<OneShotTimer>(Callback(), std::chrono::hours(1));
+    longTimer->setExpirationTimePoint(now + std::chrono::hours(1));
+    timersCache.registerTimer(longTimer);
+    REQUIRE(*timersCache.getNextExpirationTimePoint() == now + std::chrono::hours(1));
+
+    // Shorter timers registered later are not gathered at expiration time point of long one
+    std::vector<std::shared_ptr<Timer>> shortTimers{};
+    for (int i = SHORT_TIMERS_COUNT; i > 0; --i) {
+        auto timer = std::make_shared<OneShotTimer>(Callback(), std::chrono::milliseconds(i));
+        timer->setExpirationTimePoint(now + std::chrono::milliseconds(i));
+        timersCache.registerTimer(timer);
+        shortTimers.emplace_back(timer);
+    }
+
+    std::vector<std::shared_ptr<Timer>> expiredTimers{};
+    for (int i = 1; i <= SHORT_TIMERS_COUNT; ++i) {
+        REQUIRE(*timersCache.getNextExpirationTimePoint() == now + std::chrono::milliseconds(i));
+        expiredTimers.clear();
+        timersCache.extractExpiredTimers(now + std::chrono::milliseconds(i), expiredTimers);
+        REQUIRE(expiredTimers.size() == 1);
+        REQUIRE(expiredTimers.front() == shortTimers[SHORT_TIMERS_COUNT - i]);
+    }
+    REQUIRE(timersCache.size() == 1);
+    REQUIRE(*timersCache.getNextExpirationTimePoint() == now + std::chrono::hours(1));
+}
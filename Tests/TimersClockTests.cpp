@@ -0,0 +1,85 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace Timers;
+
+TEST_CASE("Clock sources test", "[Clock]") {
+    auto clockSource = GENERATE(ClockSource::STEADY, ClockSource::COARSE);
+    Clock::setSource(clockSource);
+    REQUIRE(Clock::getSource() == clockSource);
+
+    auto steadyNow = std::chrono::steady_clock::now().time_since_epoch();
+    auto now = Clock::now().time_since_epoch();
+    // All sources share epoch of steady clock
+    REQUIRE(now - steadyNow < std::chrono::milliseconds(50));
+    REQUIRE(steadyNow - now < std::chrono::milliseconds(50));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(Clock::now().time_since_epoch() - now >= std::chrono::milliseconds(20) - Clock::getResolution());
+    Clock::setSource(ClockSource::STEADY);
+}
+
+TEST_CASE("Virtual clock test", "[Clock]") {
+    Clock::setSource(ClockSource::VIRTUAL);
+    auto start = Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    REQUIRE(Clock::now() == start);
+
+    Clock::advance(std::chrono::hours(1));
+    REQUIRE(Clock::now() == start + std::chrono::hours(1));
+    Clock::advance(-std::chrono::hours(1));
+    Clock::advanceTo(start);
+    REQUIRE(Clock::now() == start + std::chrono::hours(1));
+    Clock::advanceTo(start + std::chrono::hours(2));
+    REQUIRE(Clock::now() == start + std::chrono::hours(2));
+    Clock::setSource(ClockSource::STEADY);
+}
+
+TEST_CASE("Virtual clock fast-forward simulation test", "[Clock]") {
+    Clock::setSource(ClockSource::VIRTUAL);
+    auto wallClockStart = std::chrono::steady_clock::now();
+
+    TimersEngine engine{CacheBackend::TIMING_WHEEL};
+    auto start = Clock::now();
+    auto heartbeat = std::make_shared<RepeatableTimer>([]() {}, std::chrono::seconds(1));
+    uint32_t idleTimeouts{};
+    engine.addTimer(heartbeat);
+    for (int i = 0; i < 100; ++i) {
+        engine.addTimer(makeOneShotTimer([&idleTimeouts]() { idleTimeouts++; }, std::chrono::minutes(1 + i % 30)));
+    }
+    engine.poll(Clock::now());
+
+    // Hour of timers traffic, driven by virtual clock
+    while (Clock::now() < start + std::chrono::hours(1)) {
+        Clock::advanceTo(*engine.nextDeadline());
+        engine.poll(Clock::now());
+    }
+    REQUIRE(heartbeat->getExpirationsCount() == 3600);
+    REQUIRE(idleTimeouts == 100);
+    REQUIRE(std::chrono::steady_clock::now() - wallClockStart < std::chrono::seconds(5));
+    Clock::setSource(ClockSource::STEADY);
+}
+
+TEST_CASE("TimersManager virtual clock test", "[Clock]") {
+    TimersConfiguration configuration{};
+    configuration.clockSource = ClockSource::VIRTUAL;
+    TimersManager::initialize(configuration);
+    TimersManager::start();
+
+    std::atomic<uint32_t> expirations{};
+    auto timer = std::make_shared<RepeatableTimer>([&expirations]() { expirations++; }, std::chrono::hours(1));
+    timer->start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(expirations == 0);
+
+    // Timers thread notices advanced virtual clock without real time passing
+    Clock::advance(std::chrono::hours(3));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (expirations < 3 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    TimersManager::stop();
+    REQUIRE(expirations == 3);
+    Clock::setSource(ClockSource::STEADY);
+}
@@ -0,0 +1,173 @@
+#include "Timers.hpp"
+#include "ClockSourceGuard.hpp"
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace Timers;
+
+TEST_CASE("TimersEngine poll test", "[TimersEngine]") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersEngine engine{backend};
+    REQUIRE_FALSE(engine.nextDeadline().has_value());
+
+    auto now = Clock::now();
+    uint32_t oneShotExpirations{};
+    auto oneShotTimer = std::make_shared<OneShotTimer>([&oneShotExpirations]() { oneShotExpirations++; }, now + std::chrono::milliseconds(30));
+    auto repeatableTimer = std::make_shared<RepeatableTimer>([]() {}, std::chrono::milliseconds(10));
+    repeatableTimer->setExpirationTimePoint(now + std::chrono::milliseconds(10));
+    engine.addTimer(oneShotTimer);
+    engine.addTimer(repeatableTimer);
+
+    // Actions are applied only on poll, while next deadline already covers added timers
+    REQUIRE(engine.hasPendingActions());
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::milliseconds(10));
+    REQUIRE(engine.size() == 0);
+    REQUIRE(engine.poll(now) == 0);
+    REQUIRE_FALSE(engine.hasPendingActions());
+    REQUIRE(engine.size() == 2);
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::milliseconds(10));
+
+    // Period is measured from timer's creation, slightly after now
+    auto period = repeatableTimer->getDuration();
+    REQUIRE(engine.poll(now + std::chrono::milliseconds(10)) == 1);
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::milliseconds(10) + period);
+    REQUIRE(engine.poll(now + std::chrono::milliseconds(30)) == 2);
+    REQUIRE(oneShotExpirations == 1);
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::milliseconds(10) + 2 * period);
+    REQUIRE(repeatableTimer->getExpirationsCount() == 2);
+
+    engine.eraseTimer(repeatableTimer);
+    engine.poll(now + std::chrono::milliseconds(30));
+    REQUIRE(engine.size() == 0);
+    REQUIRE_FALSE(engine.nextDeadline().has_value());
+}
+
+TEST_CASE("TimersEngine independent engines test", "[TimersEngine]") {
+    constexpr size_t ENGINES_COUNT = 4;
+    std::vector<std::thread> loops{};
+    std::atomic<size_t> expirations{};
+
+    for (size_t i = 0; i < ENGINES_COUNT; ++i) {
+        loops.emplace_back([&expirations]() {
+            TimersEngine engine{CacheBackend::HEAP};
+            auto timerId = engine.createTimer(
+                [](void* context) { ++*static_cast<std::atomic<size_t>*>(context); }, &expirations, std::chrono::milliseconds(5), true);
+            engine.startTimer(timerId);
+            engine.poll();
+            // Event loop sleeps until next deadline, as it would in epoll_wait timeout
+            while (engine.size() != 0) {
+                std::this_thread::sleep_until(*engine.nextDeadline());
+                if (engine.poll() != 0 && expirations >= 40) {
+                    engine.destroyTimer(timerId);
+                    engine.poll();
+                }
+            }
+        });
+    }
+    for (auto& loop : loops) {
+        loop.join();
+    }
+    REQUIRE(expirations >= 40);
+}
+
+TEST_CASE("TimersEngine wake up test", "[TimersEngine]") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersEngine engine{backend};
+    std::vector<Clock::time_point> wakeUps{};
+    engine.setWakeUp([&wakeUps](Clock::time_point deadline) { wakeUps.emplace_back(deadline); });
+
+    auto now = Clock::now();
+    auto longTimer = std::make_shared<OneShotTimer>([]() {}, now + std::chrono::hours(1));
+    engine.addTimer(longTimer);
+    engine.poll(now);
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::hours(1));
+    REQUIRE(wakeUps.size() == 1);
+
+    // Event loop sleeping until long timer is woken up by timer added from other thread
+    uint32_t expirations{};
+    auto shortTimer = std::make_shared<OneShotTimer>([&expirations]() { expirations++; }, now + std::chrono::milliseconds(10));
+    auto laterTimer = std::make_shared<OneShotTimer>([]() {}, now + std::chrono::milliseconds(20));
+    std::thread adding{[&]() {
+        engine.addTimer(shortTimer);
+        engine.addTimer(laterTimer);
+    }};
+    adding.join();
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::milliseconds(10));
+    REQUIRE(wakeUps.size() == 2);
+    REQUIRE(wakeUps.back() == now + std::chrono::milliseconds(10));
+
+    REQUIRE(engine.poll(now + std::chrono::milliseconds(10)) == 1);
+    REQUIRE(expirations == 1);
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::milliseconds(20));
+    REQUIRE(engine.poll(now + std::chrono::milliseconds(20)) == 1);
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::hours(1));
+
+    // Timer with slack moves deadline only to its latest expiration, so event loop wakes up once for it
+    auto slackTimer = std::make_shared<OneShotTimer>([&expirations]() { expirations++; }, now + std::chrono::milliseconds(30));
+    slackTimer->setSlack(std::chrono::milliseconds(5));
+    std::thread addingSlack{[&]() { engine.addTimer(slackTimer); }};
+    addingSlack.join();
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::milliseconds(35));
+    REQUIRE(wakeUps.back() == now + std::chrono::milliseconds(35));
+    REQUIRE(engine.poll(now + std::chrono::milliseconds(35)) == 1);
+    REQUIRE(expirations == 2);
+    REQUIRE(*engine.nextDeadline() == now + std::chrono::hours(1));
+
+    // Restarted timer expires no earlier than its duration from restart
+    auto restartedTimer = std::make_shared<OneShotTimer>([]() {}, std::chrono::milliseconds(5));
+    auto restartedAt = Clock::now();
+    engine.restartTimer(restartedTimer);
+    REQUIRE(*engine.nextDeadline() >= restartedAt + std::chrono::milliseconds(5));
+    REQUIRE(*engine.nextDeadline() < now + std::chrono::hours(1));
+    REQUIRE(wakeUps.size() == 4);
+}
+
+TEST_CASE("TimersEngine batch test", "[TimersEngine]") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersEngine engine{backend, ActionsQueue::DEFAULT_CAPACITY, true};
+
+    auto now = Clock::now();
+    uint32_t expirations{};
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (int i = 0; i < 100; ++i) {
+        timers.emplace_back(std::make_shared<OneShotTimer>([&expirations]() { expirations++; }, now + std::chrono::milliseconds(i % 7)));
+    }
+    uint32_t callbacks{};
+    engine.addTimers(timers, [&callbacks](uint8_t, bool) { callbacks++; });
+
+    // Whole batch is queued as single action
+    engine.poll(now - std::chrono::milliseconds(1));
+    REQUIRE(callbacks == 1);
+    REQUIRE(engine.size() == 100);
+    REQUIRE(engine.getStatistics().actionsProcessed == 1);
+
+    engine.eraseTimers(std::span(timers).first(50));
+    REQUIRE(engine.poll(now + std::chrono::milliseconds(10)) == 50);
+    REQUIRE(expirations == 50);
+    REQUIRE(engine.size() == 0);
+}
+
+TEST_CASE("TimersEngine execution budget test", "[TimersEngine]") {
+    ClockSourceGuard clockSourceGuard{ClockSource::VIRTUAL};
+    TimersEngine engine{CacheBackend::HEAP};
+    auto overruns = Timer::getTotalOverruns();
+    // Callback advancing virtual clock takes exactly that long
+    auto callbackTime = std::chrono::milliseconds(1);
+    auto timer = std::make_shared<RepeatableTimer>([&callbackTime]() { Clock::advance(callbackTime); }, std::chrono::milliseconds(10));
+    timer->setExecutionBudget(std::chrono::milliseconds(2));
+    REQUIRE(timer->getExecutionBudget() == std::chrono::milliseconds(2));
+    engine.addTimer(timer);
+
+    Clock::advanceTo(timer->getExpirationTimePoint());
+    REQUIRE(engine.poll(Clock::now()) == 1);
+    REQUIRE(timer->getOverruns() == 0);
+
+    callbackTime = std::chrono::milliseconds(5);
+    Clock::advanceTo(timer->getExpirationTimePoint());
+    REQUIRE(engine.poll(Clock::now()) == 1);
+    REQUIRE(timer->getOverruns() == 1);
+    REQUIRE(Timer::getTotalOverruns() == overruns + 1);
+}
@@ -0,0 +1,59 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <iostream>
+
+using namespace Timers;
+
+TEST_CASE("TimersExecutor priority test", "[TimersExecutor") {
+    std::mutex mutex{};
+    std::vector<uint32_t> executionOrder{};
+    std::vector<Timer::CallbackAction> callbackActions{};
+
+    TimersExecutor executor{1, [&](std::shared_ptr<Timer> timer, Timer::CallbackAction callbackAction, size_t) {
+                                std::lock_guard lockGuard{mutex};
+                                executionOrder.emplace_back(timer->getPriority());
+                                callbackActions.emplace_back(callbackAction);
+                            }};
+
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (uint32_t priority : {1, 5, 3, 5}) {
+        std::shared_ptr<Timer> timer = std::make_shared<OneShotTimer>([]() {});
+        timer->setPriority(priority);
+        timers.emplace_back(timer);
+    }
+    timers.emplace_back(std::make_shared<RepeatableTimer>([]() {}));
+
+    // Whole batch is queued before worker starts, so it is executed strictly by priority
+    executor.dispatch(timers);
+    executor.start();
+    executor.stop();
+
+    REQUIRE(executionOrder == std::vector<uint32_t>{5, 5, 3, 1, 0});
+    REQUIRE(callbackActions.back() == Timer::CallbackAction::NONE);
+    REQUIRE(callbackActions.front() == Timer::CallbackAction::DELETE);
+}
+
+TEST_CASE("TimersExecutor workers test", "[TimersExecutor") {
+    constexpr size_t TIMERS_COUNT = 100;
+    std::atomic<size_t> executed{};
+    std::atomic<size_t> completed{};
+    std::atomic<bool> otherOwner{false};
+
+    // Owner passed on dispatch comes back with every completed timer
+    TimersExecutor executor{4, [&](std::shared_ptr<Timer>, Timer::CallbackAction, size_t owner) {
+                                completed++;
+                                otherOwner = otherOwner || owner != 3;
+                            }};
+    executor.start();
+
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (size_t i = 0; i < TIMERS_COUNT; ++i) {
+        timers.emplace_back(std::make_shared<OneShotTimer>([&executed]() { executed++; }));
+    }
+    executor.dispatch(timers, 3);
+    executor.stop();
+
+    REQUIRE(executed == TIMERS_COUNT);
+    REQUIRE(completed == TIMERS_COUNT);
+    REQUIRE_FALSE(otherOwner);
+}
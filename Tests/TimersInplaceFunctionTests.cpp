@@ -0,0 +1,83 @@
+#include "Timers.hpp"
+#include <array>
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <cstdlib>
+#include <new>
+
+using namespace Timers;
+
+namespace {
+std::atomic<size_t> allocations{};
+} // namespace
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (auto pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+
+TEST_CASE("InplaceFunction inline storage test", "[InplaceFunction]") {
+    int value{};
+    void* connection{&value};
+    uint64_t id{42};
+    std::array<uint64_t, 3> payload{1, 2, 3};
+
+    auto before = allocations.load();
+    InplaceFunction<void()> callback{[&value, connection, id, payload]() {
+        value = static_cast<int>(id + payload[2]) + (connection != nullptr ? 1 : 0);
+    }};
+    InplaceFunction<void()> moved{std::move(callback)};
+    REQUIRE(allocations == before);
+    REQUIRE_FALSE(callback);
+    REQUIRE(moved);
+    moved();
+    REQUIRE(value == 46);
+}
+
+TEST_CASE("InplaceFunction heap fallback test", "[InplaceFunction]") {
+    std::array<uint64_t, 16> payload{};
+    payload[15] = 7;
+    uint64_t result{};
+
+    auto before = allocations.load();
+    InplaceFunction<void()> callback{[&result, payload]() { result = payload[15]; }};
+    REQUIRE(allocations == before + 1);
+    InplaceFunction<void()> moved{};
+    moved = std::move(callback);
+    REQUIRE(allocations == before + 1);
+    moved();
+    REQUIRE(result == 7);
+}
+
+TEST_CASE("InplaceFunction move-only callable test", "[InplaceFunction]") {
+    auto owned = std::make_unique<int>(5);
+    InplaceFunction<int(int)> callback{[owned = std::move(owned)](int value) { return *owned + value; }};
+    REQUIRE(callback(2) == 7);
+
+    InplaceFunction<void()> empty{nullptr};
+    REQUIRE_FALSE(empty);
+    InplaceFunction<void()> emptyStdFunction{std::function<void()>{}};
+    REQUIRE_FALSE(emptyStdFunction);
+    void (*emptyPointer)() = nullptr;
+    InplaceFunction<void()> emptyFunctionPointer{emptyPointer};
+    REQUIRE_FALSE(emptyFunctionPointer);
+}
+
+TEST_CASE("Timer creation without callback allocation test", "[InplaceFunction]") {
+    int value{};
+    void* connection{&value};
+    uint64_t id{42};
+
+    auto before = allocations.load();
+    auto timer = makeOneShotTimer([&value, connection, id]() { value = static_cast<int>(id) + (connection != nullptr ? 1 : 0); },
+                                  std::chrono::seconds(1));
+    // Only timer itself, together with its shared_ptr control block, is allocated
+    REQUIRE(allocations == before + 1);
+    REQUIRE(timer->run() == Timer::CallbackAction::DELETE);
+    REQUIRE(value == 43);
+}
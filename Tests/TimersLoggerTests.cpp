@@ -0,0 +1,64 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace Timers;
+
+namespace {
+class CountingLogger : public Logger {
+public:
+    std::atomic<uint32_t> messages{};
+    void operator()(Level, std::string_view) noexcept override { messages++; }
+};
+} // namespace
+
+TEST_CASE("Logger compile time level test", "[Logger]") {
+    static_assert(Logger::isCompiledIn(Logger::Level::Critical));
+    REQUIRE(Logger::isCompiledIn(Logger::COMPILED_LEVEL));
+
+    auto logger = std::make_shared<CountingLogger>();
+    Logger::setInstance(logger);
+    Logger::log<Logger::Level::Critical>("critical");
+    Logger::log<Logger::Level::Trace>("trace");
+    REQUIRE(logger->messages == (Logger::isCompiledIn(Logger::Level::Trace) ? 2U : 1U));
+
+    Logger::setInstance(nullptr);
+    Logger::log<Logger::Level::Critical>("dropped");
+    REQUIRE(logger->messages == (Logger::isCompiledIn(Logger::Level::Trace) ? 2U : 1U));
+}
+
+TEST_CASE("AsyncLogger writes messages test", "[Logger]") {
+    std::ostringstream output{};
+    {
+        AsyncLogger logger{output, 16};
+        std::vector<std::thread> threads{};
+        for (int thread = 0; thread < 4; ++thread) {
+            threads.emplace_back([&logger, thread]() {
+                for (int i = 0; i < 10; ++i) {
+                    logger(Logger::Level::Info, "thread " + std::to_string(thread) + " message " + std::to_string(i));
+                    // Writing thread keeps up with producers, so small ring buffer does not overflow
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        logger.flush();
+
+        std::istringstream lines{output.str()};
+        std::string line{};
+        size_t count{};
+        while (std::getline(lines, line)) {
+            REQUIRE(line.find("] Info thread ") != std::string::npos);
+            count++;
+        }
+        REQUIRE(count + logger.getDropped() == 40);
+
+        // Message longer than slot is truncated
+        logger(Logger::Level::Error, std::string(AsyncLogger::MESSAGE_CAPACITY + 10, 'x'));
+    }
+    REQUIRE(output.str().find(std::string(AsyncLogger::MESSAGE_CAPACITY, 'x') + "\n") != std::string::npos);
+}
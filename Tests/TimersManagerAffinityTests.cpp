@@ -0,0 +1,98 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace Timers;
+
+#ifdef __linux__
+namespace {
+
+std::vector<size_t> allowedCpus() {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    sched_getaffinity(0, sizeof(cpuSet), &cpuSet);
+    std::vector<size_t> cpus{};
+    for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpuSet)) {
+            cpus.emplace_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @brief - Execute function on thread pinned to processor, so THREAD_AFFINITY policy selects its shard
+ */
+template <typename Function>
+void runOn(size_t cpu, Function function) {
+    std::thread thread{[cpu, &function]() {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        function();
+    }};
+    thread.join();
+}
+
+} // namespace
+
+TEST_CASE("TimersManager thread affinity test", "[TimersManager]") {
+    auto cpus = allowedCpus();
+    if (cpus.size() < 2) {
+        WARN("Single processor available, timer is stopped and started on the same shard");
+    }
+    TimersConfiguration configuration{};
+    configuration.dispatchMode = DispatchMode::EXECUTOR;
+    configuration.executorThreads = 2;
+    configuration.shardsCount = std::max<size_t>(cpus.size(), 2);
+    configuration.shardingPolicy = ShardingPolicy::THREAD_AFFINITY;
+    TimersManager::initialize(configuration);
+    TimersManager::start();
+
+    // Timer stopped and started from other processor while its callback runs stays on shard which checked it out
+    std::atomic<bool> executing{false};
+    std::atomic<bool> overlapped{false};
+    std::atomic<uint32_t> expirations{};
+    auto timer = std::make_shared<RepeatableTimer>(
+        [&]() {
+            if (executing.exchange(true)) {
+                overlapped = true;
+            }
+            expirations++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            executing = false;
+        },
+        std::chrono::milliseconds(1));
+    timer->restart();
+    runOn(cpus.front(), [&timer]() { timer->start(); });
+    for (uint32_t i = 0; i < 20; ++i) {
+        while (expirations <= i) {
+            std::this_thread::yield();
+        }
+        runOn(cpus[(i + 1) % cpus.size()], [&timer]() {
+            timer->stop();
+            timer->start();
+        });
+    }
+    runOn(cpus.back(), [&timer]() { timer->stop(); });
+    REQUIRE(timer->getState() == Timer::IDLE);
+
+    // Stop reached shard keeping timer, so it does not fire anymore
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto stoppedExpirations = expirations.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    REQUIRE(expirations == stoppedExpirations);
+    REQUIRE(expirations >= 20);
+    REQUIRE_FALSE(overlapped);
+
+    TimersManager::stop();
+}
+#endif
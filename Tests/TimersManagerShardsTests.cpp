@@ -0,0 +1,145 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+using namespace Timers;
+
+namespace {
+
+std::string currentThreadName() {
+#ifdef __linux__
+    char name[16]{};
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    return name;
+#else
+    return {};
+#endif
+}
+
+} // namespace
+
+TEST_CASE("TimersManager shards test", "[TimersManager") {
+    TimersConfiguration configuration{};
+    configuration.cacheBackend = CacheBackend::HEAP;
+    configuration.dispatchMode = DispatchMode::EXECUTOR;
+    configuration.executorThreads = 2;
+    configuration.shardsCount = 4;
+    // Timers of lowest priority lane go to separate bulk executor
+    configuration.bulkExecutorThreads = 1;
+    // Repeatable timer below keeps overrunning its budget, so it is moved to slow lane thread
+    configuration.executionBudget = std::chrono::milliseconds(20);
+    configuration.slowLaneOverruns = 2;
+    TimersManager::initialize(configuration);
+    REQUIRE(TimersManager::getShardsCount() == 4);
+
+    TimersManager::start();
+    REQUIRE(TimersManager::isRunning() == true);
+
+    constexpr size_t TIMERS_COUNT = 64;
+    std::atomic<size_t> oneShotExpirations{};
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (size_t i = 0; i < TIMERS_COUNT; ++i) {
+        auto timer = makeOneShotTimer([&oneShotExpirations]() { oneShotExpirations++; }, std::chrono::milliseconds(50 + i));
+        timer->restart();
+        timer->startAsync();
+        timers.emplace_back(timer);
+    }
+
+    // Repeatable timer executed on worker threads never runs concurrently with itself
+    std::atomic<bool> executing{false};
+    std::atomic<bool> overlapped{false};
+    std::atomic<uint32_t> repeatableExpirations{};
+    std::mutex executedOnMutex{};
+    std::vector<std::pair<std::thread::id, std::string>> executedOn{};
+    auto repeatableTimer = std::make_shared<RepeatableTimer>(
+        [&]() {
+            if (executing.exchange(true)) {
+                overlapped = true;
+            }
+            {
+                std::lock_guard lockGuard{executedOnMutex};
+                executedOn.emplace_back(std::this_thread::get_id(), currentThreadName());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            repeatableExpirations++;
+            executing = false;
+        },
+        std::chrono::milliseconds(10));
+    repeatableTimer->restart();
+    repeatableTimer->startAsync();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    REQUIRE(oneShotExpirations == TIMERS_COUNT);
+    REQUIRE(repeatableExpirations > 2);
+    REQUIRE_FALSE(overlapped);
+    REQUIRE(repeatableTimer->getOverruns() > 0);
+    REQUIRE(TimersManager::getOverruns() >= repeatableTimer->getOverruns());
+    {
+        // Every execution overruns budget, so timer is executed on slow lane thread from execution following slowLaneOverruns
+        std::lock_guard lockGuard{executedOnMutex};
+        REQUIRE(executedOn.size() > configuration.slowLaneOverruns + 1);
+        auto slowLaneThread = executedOn[configuration.slowLaneOverruns].first;
+        for (size_t execution = 0; execution < executedOn.size(); ++execution) {
+            INFO("Execution " << execution);
+            REQUIRE((execution < configuration.slowLaneOverruns) == (executedOn[execution].first != slowLaneThread));
+        }
+#ifdef __linux__
+        REQUIRE(executedOn.front().second == "timers-bulk-0");
+        REQUIRE(executedOn.back().second == "timers-slow-0");
+#endif
+    }
+
+    // Batch is split between shards, each of them gets single action
+    std::atomic<size_t> batchExpirations{};
+    std::atomic<size_t> batchCallbacks{};
+    std::vector<std::shared_ptr<Timer>> batch{};
+    for (size_t i = 0; i < TIMERS_COUNT; ++i) {
+        auto timer = makeOneShotTimer([&batchExpirations]() { batchExpirations++; }, std::chrono::milliseconds(20 + i % 5));
+        timer->restart();
+        batch.emplace_back(timer);
+    }
+    TimersManager::addTimers(batch, [&batchCallbacks](uint8_t, bool) { batchCallbacks++; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    REQUIRE(batchExpirations == TIMERS_COUNT);
+    REQUIRE(batchCallbacks >= 1);
+    REQUIRE(batchCallbacks <= TimersManager::getShardsCount());
+
+    // Timer stopped and started again while its callback runs on executor is registered once callback returns
+    std::atomic<bool> restartedExecuting{false};
+    std::atomic<bool> restartedOverlapped{false};
+    std::atomic<uint32_t> restartedExpirations{};
+    auto restartedTimer = std::make_shared<RepeatableTimer>(
+        [&]() {
+            if (restartedExecuting.exchange(true)) {
+                restartedOverlapped = true;
+            }
+            restartedExpirations++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(15));
+            restartedExecuting = false;
+        },
+        std::chrono::milliseconds(1));
+    // Priority above bulk lanes, so timer is executed by pool of two workers
+    restartedTimer->setPriority(1);
+    restartedTimer->restart();
+    restartedTimer->startAsync();
+    for (uint32_t i = 0; i < 20; ++i) {
+        while (restartedExpirations <= i) {
+            std::this_thread::yield();
+        }
+        restartedTimer->stop();
+        restartedTimer->start();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    restartedTimer->stop();
+    REQUIRE(restartedExpirations >= 20);
+    REQUIRE_FALSE(restartedOverlapped);
+
+    TimersManager::stop();
+    REQUIRE(TimersManager::isRunning() == false);
+}
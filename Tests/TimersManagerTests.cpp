@@ -16,7 +16,7 @@ TEST_CASE( "TimersManager initialization test", "[TimersManager" ) {
     TimersManager::start();
     REQUIRE(TimersManager::isRunning() == true);
 
-    std::chrono::high_resolution_clock::time_point now = std::chrono::high_resolution_clock::now();
+    Clock::time_point now = Clock::now();
 
     int value = 5;
     std::shared_ptr<Timer> timer_1 = std::make_shared<OneShotTimer>([&value]() {
@@ -28,6 +28,81 @@ TEST_CASE( "TimersManager initialization test", "[TimersManager" ) {
     std::this_thread::sleep_for(std::chrono::seconds(6));
     REQUIRE(value == 7);
 
+    // Repeatable timer is registered again at its next period after every expiration
+    std::atomic<uint32_t> expirations{};
+    auto timer_2 = std::make_shared<RepeatableTimer>([&expirations]() { expirations++; }, std::chrono::milliseconds(100));
+    timer_2->restart();
+    timer_2->startAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds(550));
+    REQUIRE(expirations >= 4);
+    REQUIRE(expirations <= 6);
+
+    // Synchronous start and stop wait on timer state, concurrent stoppers share single stop action
+    auto timer_3 = std::make_shared<RepeatableTimer>([]() {}, std::chrono::milliseconds(10));
+    timer_3->start();
+    REQUIRE(timer_3->getState() != Timer::IDLE);
+    std::vector<std::thread> stoppers{};
+    for (int i = 0; i < 8; ++i) {
+        stoppers.emplace_back([&timer_3]() { timer_3->stop(); });
+    }
+    for (auto& stopper : stoppers) {
+        stopper.join();
+    }
+    REQUIRE(timer_3->getState() == Timer::IDLE);
+    REQUIRE_FALSE(timer_3->isRunning());
+
+    // One shot timer is idle again once it expired
+    auto timer_4 = makeOneShotTimer([]() {}, std::chrono::milliseconds(10));
+    timer_4->start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    REQUIRE(timer_4->getState() == Timer::IDLE);
+
+    // Lazily cancelled timer becomes idle once it is discarded at its expiration
+    std::atomic<uint32_t> cancelledExpirations{};
+    auto timer_5 = makeOneShotTimer([&cancelledExpirations]() { cancelledExpirations++; }, std::chrono::milliseconds(50));
+    timer_5->restart();
+    timer_5->start();
+    timer_5->cancel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    REQUIRE(timer_5->getState() == Timer::IDLE);
+    REQUIRE_FALSE(timer_5->isRunning());
+    REQUIRE(cancelledExpirations == 0);
+
+    // Lazily cancelled timer becomes idle once it is discarded by compaction, long before its expiration
+    auto timer_6 = makeOneShotTimer([]() {}, std::chrono::seconds(30));
+    timer_6->start();
+    timer_6->cancel();
+    // Compaction is done by timers thread only when it wakes up, after compaction interval
+    auto wakeUp = makeOneShotTimer([]() {}, TimersCache::DEFAULT_COMPACTION_INTERVAL + std::chrono::milliseconds(100));
+    wakeUp->start();
+    std::this_thread::sleep_for(TimersCache::DEFAULT_COMPACTION_INTERVAL + std::chrono::milliseconds(300));
+    REQUIRE(timer_6->getState() == Timer::IDLE);
+
+    // Discarded timers are started again, and fire
+    timer_5->restart();
+    timer_5->start();
+    timer_6->setExpirationTimePoint(Clock::now() + std::chrono::milliseconds(50));
+    std::atomic<bool> compactedFired{false};
+    timer_6->setCallback([&compactedFired]() { compactedFired = true; });
+    timer_6->start();
+    REQUIRE_FALSE(timer_6->isCancelled());
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    REQUIRE(cancelledExpirations == 1);
+    REQUIRE(compactedFired);
+    cancelledExpirations = 0;
+
+    // Starting lazily cancelled timer before its expiration clears tombstone, it fires after its duration from now
+    auto timer_7 = makeOneShotTimer([&cancelledExpirations]() { cancelledExpirations++; }, std::chrono::milliseconds(50));
+    timer_7->restart();
+    timer_7->start();
+    timer_7->cancel();
+    timer_7->start();
+    REQUIRE(timer_7->getState() == Timer::ARMED);
+    REQUIRE_FALSE(timer_7->isCancelled());
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    REQUIRE(cancelledExpirations == 1);
+    REQUIRE(timer_7->getState() == Timer::IDLE);
+
     TimersManager::stop();
     REQUIRE(TimersManager::isRunning() == false);
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "Timers.hpp"
+#include "Internal/TimersSlab.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Timers;
+
+namespace {
+void countExpiration(void* context) { ++*static_cast<size_t*>(context); }
+} // namespace
+
+TEST_CASE("TimersSlab stale handle test", "[TimersSlab]") {
+    TimersSlab slab{};
+    size_t expirations{};
+
+    auto timerId = slab.create(countExpiration, &expirations, std::chrono::seconds(1), false);
+    REQUIRE(timerId.isValid());
+    REQUIRE(slab.find(timerId) != nullptr);
+    REQUIRE(slab.size() == 1);
+
+    REQUIRE(slab.destroy(timerId));
+    REQUIRE(slab.find(timerId) == nullptr);
+    REQUIRE_FALSE(slab.destroy(timerId));
+
+    // Record is reused, old handle stays stale
+    auto reusedTimerId = slab.create(countExpiration, &expirations, std::chrono::seconds(1), false);
+    REQUIRE(reusedTimerId.index() == timerId.index());
+    REQUIRE(reusedTimerId != timerId);
+    REQUIRE(slab.find(timerId) == nullptr);
+    REQUIRE(slab.find(reusedTimerId) != nullptr);
+    REQUIRE(slab.find(TimerId{}) == nullptr);
+
+    REQUIRE_THROWS_AS(slab.create(countExpiration, nullptr, std::chrono::seconds(0), true), TimerError);
+}
+
+TEST_CASE("SlabSchedule expiration test", "[TimersSlab]") {
+    TimersSlab slab{};
+    SlabSchedule schedule{slab};
+    size_t oneShotExpirations{};
+    size_t repeatableExpirations{};
+    auto now = Clock::now();
+
+    auto oneShotTimerId = slab.create(countExpiration, &oneShotExpirations, std::chrono::milliseconds(10), false);
+    auto repeatableTimerId = slab.create(countExpiration, &repeatableExpirations, std::chrono::milliseconds(10), true);
+    auto stoppedTimerId = slab.create(countExpiration, &oneShotExpirations, std::chrono::milliseconds(10), false);
+    REQUIRE(schedule.arm(oneShotTimerId, now + std::chrono::milliseconds(20)));
+    REQUIRE(schedule.arm(repeatableTimerId, now + std::chrono::milliseconds(10)));
+    REQUIRE(schedule.arm(stoppedTimerId, now + std::chrono::milliseconds(5)));
+    // Armed timer is moved, not duplicated
+    REQUIRE(schedule.arm(oneShotTimerId, now + std::chrono::milliseconds(15)));
+    REQUIRE(schedule.size() == 3);
+    REQUIRE(schedule.disarm(stoppedTimerId));
+    REQUIRE_FALSE(schedule.disarm(stoppedTimerId));
+    REQUIRE(*schedule.nextExpirationTimePoint() == now + std::chrono::milliseconds(10));
+
+    REQUIRE(schedule.expire(now + std::chrono::milliseconds(35)) == 4);
+    REQUIRE(oneShotExpirations == 1);
+    REQUIRE(repeatableExpirations == 3);
+    REQUIRE(schedule.size() == 1);
+    REQUIRE(*schedule.nextExpirationTimePoint() == now + std::chrono::milliseconds(40));
+
+    REQUIRE(schedule.destroy(repeatableTimerId));
+    REQUIRE(schedule.size() == 0);
+    REQUIRE_FALSE(schedule.arm(repeatableTimerId, now));
+    REQUIRE(slab.size() == 2);
+}
+
+TEST_CASE("TimersManager timer handle test", "[TimersSlab]") {
+    TimersManager::initialize();
+    TimersManager::start();
+
+    std::atomic<size_t> expirations{};
+    auto timerId = TimersManager::createTimer(
+        [](void* context) { ++*static_cast<std::atomic<size_t>*>(context); }, &expirations, std::chrono::milliseconds(20), true);
+    TimersManager::startTimer(timerId);
+    std::this_thread::sleep_for(std::chrono::milliseconds(110));
+    TimersManager::stopTimer(timerId);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto stoppedExpirations = expirations.load();
+    REQUIRE(stoppedExpirations >= 3);
+    REQUIRE(stoppedExpirations <= 6);
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    REQUIRE(expirations == stoppedExpirations);
+
+    TimersManager::destroyTimer(timerId);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE_THROWS_AS(TimersManager::startTimer(timerId), TimerError);
+
+    TimersManager::stop();
+}
@@ -0,0 +1,90 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace Timers;
+
+TEST_CASE("Lateness histogram buckets test", "[TimersStatistics]") {
+    // Small values have exact buckets
+    for (uint64_t value = 0; value < LatenessHistogram::SUB_BUCKETS; ++value) {
+        REQUIRE(LatenessHistogram::lowerBoundOf(LatenessHistogram::bucketOf(value)) == value);
+    }
+
+    // Larger values are counted with bounded relative error
+    for (uint64_t value : {uint64_t{17}, uint64_t{1000}, uint64_t{123456}, uint64_t{1} << 40, UINT64_MAX}) {
+        auto bucket = LatenessHistogram::bucketOf(value);
+        REQUIRE(bucket < LatenessHistogram::BUCKETS);
+        auto lowerBound = LatenessHistogram::lowerBoundOf(bucket);
+        REQUIRE(lowerBound <= value);
+        REQUIRE(value - lowerBound <= lowerBound / LatenessHistogram::SUB_BUCKETS);
+        if (bucket + 1 < LatenessHistogram::BUCKETS) {
+            REQUIRE(value < LatenessHistogram::lowerBoundOf(bucket + 1));
+        }
+    }
+}
+
+TEST_CASE("TimersEngine statistics test", "[TimersStatistics]") {
+    auto backend = GENERATE(CacheBackend::MULTIMAP, CacheBackend::TIMING_WHEEL, CacheBackend::HEAP);
+    TimersEngine engine{backend, ActionsQueue::DEFAULT_CAPACITY, true};
+
+    auto now = Clock::now();
+    for (int i = 1; i <= 10; ++i) {
+        engine.addTimer(std::make_shared<OneShotTimer>([]() {}, now + std::chrono::milliseconds(i)));
+    }
+    auto timerId = engine.createTimer([](void*) {}, nullptr, std::chrono::milliseconds(1));
+    engine.startTimer(timerId);
+    engine.poll(now);
+
+    auto statistics = engine.getStatistics();
+    REQUIRE(statistics.actionsProcessed == 11);
+    REQUIRE(statistics.actionsQueueHighWater == 11);
+    REQUIRE(statistics.cacheSize == 11);
+    REQUIRE(statistics.latenessSamples() == 0);
+
+    // Every timer fires late by at least 5 milliseconds
+    REQUIRE(engine.poll(now + std::chrono::milliseconds(15)) == 11);
+    statistics = engine.getStatistics();
+    REQUIRE(statistics.callbacksExecuted == 11);
+    REQUIRE(statistics.cacheSize == 0);
+    REQUIRE(statistics.latenessSamples() == 11);
+    REQUIRE(statistics.latenessPercentile(0.0) >= std::chrono::microseconds(4700));
+    REQUIRE(statistics.latenessPercentile(1.0) <= std::chrono::milliseconds(14));
+    REQUIRE(statistics.latenessMax <= std::chrono::milliseconds(14));
+    REQUIRE(statistics.productiveWakeUps == 0);
+    REQUIRE(statistics.spuriousWakeUps == 0);
+
+    TimersEngine disabledEngine{};
+    REQUIRE_THROWS_AS(disabledEngine.getStatistics(), TimerError);
+}
+
+TEST_CASE("TimersManager statistics test", "[TimersStatistics]") {
+    TimersConfiguration configuration{};
+    configuration.cacheBackend = CacheBackend::HEAP;
+    configuration.shardsCount = 2;
+    configuration.collectStatistics = true;
+    TimersManager::initialize(configuration);
+    TimersManager::start();
+
+    std::atomic<uint32_t> expirations{};
+    std::vector<std::shared_ptr<Timer>> timers{};
+    for (int i = 0; i < 8; ++i) {
+        auto timer = makeOneShotTimer([&expirations]() { expirations++; }, std::chrono::milliseconds(10 + 5 * i));
+        timer->restart();
+        timer->startAsync();
+        timers.emplace_back(timer);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    REQUIRE(expirations == 8);
+
+    auto statistics = TimersManager::getStatistics();
+    REQUIRE(statistics.callbacksExecuted == 8);
+    REQUIRE(statistics.latenessSamples() == 8);
+    REQUIRE(statistics.actionsProcessed >= 8);
+    REQUIRE(statistics.actionsQueueHighWater >= 1);
+    REQUIRE(statistics.productiveWakeUps >= 1);
+    REQUIRE(statistics.cacheSize == 0);
+    REQUIRE(statistics.latenessPercentile(0.5) <= statistics.latenessMax);
+
+    TimersManager::stop();
+}
@@ -0,0 +1,88 @@
+#include "Timers.hpp"
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <thread>
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+using namespace Timers;
+
+TEST_CASE("ThreadControl wait test", "[ThreadControl]") {
+    auto waitBackend = GENERATE(WaitBackend::CONDITION_VARIABLE, WaitBackend::TIMERFD);
+    ThreadControl threadControl{waitBackend};
+    std::atomic<bool> hasWork{false};
+    auto predicate = [&hasWork]() { return hasWork.load(); };
+
+    auto start = Clock::now();
+    REQUIRE(threadControl.waitUntil(start + std::chrono::milliseconds(20), predicate));
+    REQUIRE(Clock::now() - start >= std::chrono::milliseconds(20));
+    REQUIRE(threadControl.waitUntil(start, predicate));
+
+    std::thread notifier{[&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        hasWork = true;
+        threadControl.notify();
+    }};
+    start = Clock::now();
+    REQUIRE_FALSE(threadControl.waitUntil(std::nullopt, predicate));
+    notifier.join();
+    REQUIRE(Clock::now() - start < std::chrono::seconds(5));
+}
+
+TEST_CASE("ThreadControl precision wait test", "[ThreadControl]") {
+    auto waitBackend = GENERATE(WaitBackend::CONDITION_VARIABLE, WaitBackend::TIMERFD);
+    auto waitMode = GENERATE(WaitMode::SPIN, WaitMode::BUSY_POLL);
+    ThreadControl threadControl{waitBackend, waitMode, std::chrono::microseconds(500)};
+    std::atomic<bool> hasWork{false};
+    auto predicate = [&hasWork]() { return hasWork.load(); };
+
+    std::vector<Clock::duration> latenesses{};
+    for (int i = 0; i < 11; ++i) {
+        auto timePoint = Clock::now() + std::chrono::milliseconds(2);
+        REQUIRE(threadControl.waitUntil(timePoint, predicate));
+        latenesses.emplace_back(Clock::now() - timePoint);
+    }
+    // Median is checked with generous bound, single wait may still be late when thread is preempted
+    std::nth_element(std::begin(latenesses), std::begin(latenesses) + 5, std::end(latenesses));
+    REQUIRE(latenesses[5] < std::chrono::microseconds(500));
+
+    hasWork = true;
+    REQUIRE_FALSE(threadControl.waitUntil(Clock::now() + std::chrono::seconds(10), predicate));
+}
+
+#ifdef __linux__
+TEST_CASE("ThreadControl exported descriptor test", "[ThreadControl]") {
+    ThreadControl conditionVariableControl{WaitBackend::CONDITION_VARIABLE};
+    REQUIRE(conditionVariableControl.fd() == -1);
+
+    ThreadControl threadControl{WaitBackend::TIMERFD};
+    REQUIRE(threadControl.fd() >= 0);
+    pollfd descriptor{threadControl.fd(), POLLIN, 0};
+    REQUIRE(poll(&descriptor, 1, 0) == 0);
+    threadControl.notify();
+    REQUIRE(poll(&descriptor, 1, 0) == 1);
+}
+#endif
+
+TEST_CASE("TimersManager TIMERFD wait backend test", "[ThreadControl]") {
+    TimersConfiguration configuration{};
+    configuration.waitBackend = WaitBackend::TIMERFD;
+    TimersManager::initialize(configuration);
+    TimersManager::start();
+#ifdef __linux__
+    REQUIRE(TimersManager::getWaitFd() >= 0);
+#endif
+
+    std::atomic<uint32_t> expirations{};
+    auto timer = std::make_shared<RepeatableTimer>([&expirations]() { expirations++; }, std::chrono::milliseconds(50));
+    auto oneShotTimer = makeOneShotTimer([&expirations]() { expirations += 100; }, std::chrono::milliseconds(120));
+    timer->start();
+    oneShotTimer->start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(275));
+    TimersManager::stop();
+    REQUIRE(expirations / 100 == 1);
+    REQUIRE(expirations % 100 >= 4);
+    REQUIRE(expirations % 100 <= 6);
+}
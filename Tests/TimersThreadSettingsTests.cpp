@@ -0,0 +1,95 @@
+#include "Timers.hpp"
+#include <catch2/catch.hpp>
+#include <future>
+#include <thread>
+#include <tuple>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace Timers;
+
+#ifdef __linux__
+namespace {
+
+std::string currentThreadName() {
+    char name[16]{};
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    return name;
+}
+
+size_t firstAllowedCpu() {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    sched_getaffinity(0, sizeof(cpuSet), &cpuSet);
+    for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpuSet)) {
+            return cpu;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+TEST_CASE("Thread settings test", "[TimersThreadSettings]") {
+    auto cpu = firstAllowedCpu();
+    ThreadSettings settings{};
+    settings.cpus = {cpu};
+    settings.name = "settings-test";
+    settings.stackPrefault = 64 * 1024;
+
+    std::promise<std::tuple<bool, std::string, int>> result{};
+    std::thread thread{[&]() {
+        auto applied = applyThreadSettings(settings, 12);
+        result.set_value({applied, currentThreadName(), sched_getcpu()});
+    }};
+    thread.join();
+    auto [applied, name, runningOn] = result.get_future().get();
+    REQUIRE(applied);
+    // Index is kept, prefix is truncated to fit into thread name
+    REQUIRE(name == "settings-tes-12");
+    REQUIRE(runningOn == static_cast<int>(cpu));
+}
+
+TEST_CASE("Thread settings oversized stack pre-fault test", "[TimersThreadSettings]") {
+    ThreadSettings settings{};
+    settings.name = "oversized";
+    // Far beyond default stack of thread, pre-faulting it would overflow stack
+    settings.stackPrefault = 1024 * 1024 * 1024;
+
+    std::promise<std::tuple<bool, std::string>> result{};
+    std::thread thread{[&]() {
+        auto applied = applyThreadSettings(settings, 0);
+        result.set_value({applied, currentThreadName()});
+    }};
+    thread.join();
+    auto [applied, name] = result.get_future().get();
+    REQUIRE_FALSE(applied);
+    // Remaining settings are still applied
+    REQUIRE(name == "oversized-0");
+}
+
+TEST_CASE("TimersManager thread settings test", "[TimersThreadSettings]") {
+    TimersConfiguration configuration{};
+    configuration.dispatchMode = DispatchMode::EXECUTOR;
+    configuration.executorThreads = 1;
+    configuration.shardsCount = 1;
+    TimersManager::initialize(configuration);
+
+    ThreadsConfiguration threadsConfiguration{};
+    threadsConfiguration.runner.cpus = {firstAllowedCpu()};
+    threadsConfiguration.runner.stackPrefault = 64 * 1024;
+    threadsConfiguration.executor.name = "callbacks";
+    TimersManager::start(threadsConfiguration);
+
+    std::promise<std::string> executedOn{};
+    auto timer = makeOneShotTimer([&executedOn]() { executedOn.set_value(currentThreadName()); }, std::chrono::milliseconds(10));
+    timer->start();
+    auto future = executedOn.get_future();
+    REQUIRE(future.wait_for(std::chrono::seconds(2)) == std::future_status::ready);
+    REQUIRE(future.get() == "callbacks-0");
+    TimersManager::stop();
+}
+#endif
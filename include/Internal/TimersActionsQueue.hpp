@@ -1,36 +1,164 @@
 #pragma once
 #include "Internal/TimersCache.hpp"
 #include "Internal/TimersImplementation.hpp"
+#include "Internal/TimersSlab.hpp"
 #include "Internal/TimersThreadControl.hpp"
+#include <atomic>
 #include <memory>
-#include <queue>
+#include <memory_resource>
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace Timers {
 
-enum TIMER_ACTION { START, STOP, RESTART };
+enum TIMER_ACTION { START, STOP, RESTART, RESCHEDULE, RELEASE, START_HANDLE, STOP_HANDLE, DESTROY_HANDLE, START_BATCH, STOP_BATCH };
 
 typedef std::pair<TIMER_ACTION, std::shared_ptr<Timers::Timer>> TimerAction;
 
+/**
+ * @brief - Function called on timers thread, after action was taken
+ */
+using ActionCallback = InplaceFunction<void(uint8_t retCode, bool newRunningState)>;
+
 struct Action {
     TIMER_ACTION m_action;
     std::shared_ptr<Timers::Timer> m_timer;
-    std::function<void(uint8_t retCode, bool newRunningState)> m_callback;
-    Action(TIMER_ACTION action, std::shared_ptr<Timers::Timer> timer, std::function<void(uint8_t retCode, bool newRunningState)> callback)
+    ActionCallback m_callback;
+    TimerId m_timerId{};
+    Clock::time_point m_timePoint{};
+    std::vector<std::shared_ptr<Timers::Timer>> m_timers{};
+    Action(TIMER_ACTION action, std::shared_ptr<Timers::Timer> timer, ActionCallback callback)
         : m_action{action}, m_timer{std::move(std::move(timer))}, m_callback{std::move(callback)} {}
+    Action(TIMER_ACTION action, std::vector<std::shared_ptr<Timers::Timer>> timers, ActionCallback callback)
+        : m_action{action}, m_callback{std::move(callback)}, m_timers{std::move(timers)} {}
+    Action(TIMER_ACTION action, TimerId timerId, Clock::time_point timePoint)
+        : m_action{action}, m_timerId{timerId}, m_timePoint{timePoint} {}
 };
 
+/**
+ * @brief - Lock-free multi-producer, single-consumer queue of actions taken on timers thread
+ * @details - Actions are stored in pre-allocated nodes. Producers take node from lock-free free list and push it on
+ *            pending stack with single CAS, timers thread takes whole pending batch with one atomic exchange.
+ *            Only when all pre-allocated nodes are in use, node is allocated from overflow memory resource.
+ */
 class ActionsQueue {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
 private:
-    std::mutex m_mutex;
+    /**
+     * @brief - Free list entry referring to no node
+     */
+    static constexpr uint32_t NO_NODE = 0;
+
+    struct Node {
+        std::optional<Action> action{};
+        /**
+         * @brief - Next node on pending stack
+         */
+        Node* next{nullptr};
+        /**
+         * @brief - Index + 1 of next node on free list
+         */
+        std::atomic<uint32_t> nextFree{NO_NODE};
+        /**
+         * @brief - Defines, if node belongs to pre-allocated pool
+         */
+        bool pooled{true};
+    };
+
     ThreadControl& m_timersThreadControl;
     TimersCache& m_timersCache;
-    std::queue<Action> m_actionsQueue{};
+    /**
+     * @brief - Schedule of slab timers, nullptr if handle actions are not supported
+     */
+    SlabSchedule* m_slabSchedule;
+    /**
+     * @brief - Number of pre-allocated nodes
+     */
+    size_t m_capacity;
+    /**
+     * @brief - Pre-allocated nodes
+     */
+    std::unique_ptr<Node[]> m_nodes;
+    /**
+     * @brief - Memory resource of nodes allocated above capacity, used by producers concurrently
+     */
+    std::pmr::memory_resource* m_overflowResource;
+    /**
+     * @brief - Top of free list, index + 1 of node in lower half, modification tag in upper half
+     */
+    std::atomic<uint64_t> m_freeList{};
+    /**
+     * @brief - Top of stack of pushed actions, most recent first
+     */
+    std::atomic<Node*> m_pending{nullptr};
+
+    /**
+     * @brief - Take node from free list, or allocate it when free list is empty
+     */
+    Node* acquireNode();
+    /**
+     * @brief - Put node with constructed action on pending stack
+     * @return - true if queue was empty before
+     */
+    bool pushNode(Node* node);
+    /**
+     * @brief - Return node taken by acquireNode
+     */
+    void releaseNode(Node* node);
+    /**
+     * @brief - Execute single action on timers container
+     */
+    void execute(Action& action);
+    /**
+     * @brief - Execute single action on slab timer
+     */
+    void executeHandleAction(Action& action);
 
 public:
-    explicit ActionsQueue(ThreadControl& timersThreadControl, TimersCache& timersCache);
-    void push(TIMER_ACTION, std::shared_ptr<Timers::Timer>, std::function<void(uint8_t retCode, bool newRunningState)>);
-    void process();
+    /**
+     * @brief - Actions queue constructor
+     * @param timersThreadControl - Timers thread controller
+     * @param timersCache - Timers container on which actions are taken
+     * @param capacity - Number of pre-allocated nodes
+     * @param slabSchedule - Schedule of slab timers, on which handle actions are taken
+     * @param overflowResource - Thread-safe memory resource of nodes allocated above capacity
+     */
+    explicit ActionsQueue(ThreadControl& timersThreadControl, TimersCache& timersCache, size_t capacity = DEFAULT_CAPACITY,
+                          SlabSchedule* slabSchedule = nullptr,
+                          std::pmr::memory_resource* overflowResource = std::pmr::new_delete_resource());
+    /**
+     * @brief - Actions queue destructor, drops not processed actions
+     */
+    ~ActionsQueue();
+    ActionsQueue(const ActionsQueue&) = delete;
+    ActionsQueue& operator=(const ActionsQueue&) = delete;
+    /**
+     * @brief - Queue action, can be called from any thread
+     * @return - true if queue was empty before, so timers thread has to be woken up
+     */
+    bool push(TIMER_ACTION, std::shared_ptr<Timers::Timer>, ActionCallback);
+    /**
+     * @brief - Queue action on slab timer, can be called from any thread
+     * @return - true if queue was empty before, so timers thread has to be woken up
+     */
+    bool push(TIMER_ACTION, TimerId, Clock::time_point);
+    /**
+     * @brief - Queue action on batch of timers as single node, can be called from any thread
+     * @return - true if queue was empty before, so timers thread has to be woken up
+     */
+    bool push(TIMER_ACTION, std::vector<std::shared_ptr<Timers::Timer>>, ActionCallback);
+    /**
+     * @brief - Check if there are actions waiting for processing
+     */
+    [[nodiscard]] bool hasPendingActions() const;
+    /**
+     * @brief - Process all queued actions, must be called only from timers thread
+     * @return - Number of processed actions
+     */
+    size_t process();
 };
 
-} // namespace Timers
\ No newline at end of file
+} // namespace Timers
@@ -0,0 +1,103 @@
+#pragma once
+#include "Internal/TimersClock.hpp"
+#include "Internal/TimersLogger.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+
+namespace Timers {
+
+/**
+ * @brief - Logger passing diagnostics through bounded ring buffer to its own writing thread
+ * @details - Logging thread only copies message into free slot of ring buffer, without locks or allocations.
+ *            Messages are formatted with level and time point, and written to output stream on writing thread.
+ *            When ring buffer is full, messages are dropped and counted, so logging never blocks timers thread.
+ */
+class AsyncLogger : public Logger {
+public:
+    /**
+     * @brief - Number of message characters kept in ring buffer slot, longer messages are truncated
+     */
+    static constexpr size_t MESSAGE_CAPACITY = 112;
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    /**
+     * @brief - Asynchronous logger constructor, starts writing thread
+     * @param output - Stream to which messages are written, it has to outlive logger
+     * @param capacity - Number of ring buffer slots, rounded up to power of two
+     */
+    explicit AsyncLogger(std::ostream& output, size_t capacity = DEFAULT_CAPACITY);
+    /**
+     * @brief - Asynchronous logger destructor, writes all queued messages and stops writing thread
+     */
+    ~AsyncLogger() override;
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    /**
+     * @brief - Queue message, can be called from any thread
+     * @param level - Level of message
+     * @param message - Message, truncated to MESSAGE_CAPACITY characters
+     */
+    void operator()(Level level, std::string_view message) noexcept override;
+    /**
+     * @brief - Wait until all messages queued before call are written and output is flushed
+     */
+    void flush();
+    /**
+     * @brief - Get number of messages dropped, because ring buffer was full
+     */
+    [[nodiscard]] uint64_t getDropped() const;
+
+private:
+    struct Slot {
+        /**
+         * @brief - Position for which slot is free when equal to it, filled when equal to position + 1
+         */
+        std::atomic<uint64_t> sequence{};
+        Level level{};
+        uint8_t length{};
+        Clock::time_point timePoint{};
+        std::array<char, MESSAGE_CAPACITY> message{};
+    };
+
+    std::ostream& m_output;
+    size_t m_mask;
+    std::unique_ptr<Slot[]> m_slots;
+    /**
+     * @brief - Position of next slot filled by logging threads
+     */
+    std::atomic<uint64_t> m_enqueuePosition{};
+    /**
+     * @brief - Position of next slot written by writing thread
+     */
+    uint64_t m_dequeuePosition{};
+    /**
+     * @brief - Number of queued messages, writing thread waits on it when ring buffer is empty
+     */
+    std::atomic<uint64_t> m_queued{};
+    /**
+     * @brief - Number of written messages, flush waits on it
+     */
+    std::atomic<uint64_t> m_written{};
+    std::atomic<uint64_t> m_dropped{};
+    std::atomic<bool> m_running{true};
+    std::thread m_writingThread{};
+
+    /**
+     * @brief - Write queued messages until logger is destroyed
+     */
+    void run();
+    /**
+     * @brief - Take all filled slots, and format them into buffer
+     * @return - Number of taken messages
+     */
+    size_t drain(std::string& buffer);
+};
+
+} // namespace Timers
@@ -0,0 +1,136 @@
+#pragma once
+#include "Internal/TimersClock.hpp"
+#include "Internal/TimersImplementation.hpp"
+#include <atomic>
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <stop_token>
+
+namespace Timers {
+
+/**
+ * @brief - Executor on which coroutines awaiting timers are resumed, instead of timers thread
+ */
+class CoroutineExecutor {
+public:
+    virtual ~CoroutineExecutor() = default;
+    /**
+     * @brief - Resume coroutine on executor, called from timers thread
+     * @param handle - Coroutine which finished waiting
+     */
+    virtual void post(std::coroutine_handle<> handle) = 0;
+};
+
+/**
+ * @brief - Awaitable suspending coroutine until time point, without any heap allocation
+ * @details - Timer node lives inside of awaitable, so inside of coroutine frame, and is registered in TimersManager
+ *            without reference counting. Expired coroutine is resumed directly on timers thread, or posted to executor.
+ *            Waiting is cancelled by stop token, then coroutine is resumed once timer was removed from cache
+ */
+class SleepAwaitable {
+private:
+    /**
+     * @brief - State of waiting, only one of expiration and cancellation resumes coroutine
+     * @details - IDLE ( Timer is being registered )
+     * @details - ARMED ( Timer is registered, coroutine is suspended )
+     * @details - EXPIRED ( Timer expired after coroutine was suspended, it was resumed by timers thread )
+     * @details - EXPIRED_EARLY ( Timer expired before registration finished, coroutine is not suspended at all )
+     * @details - CANCELLED ( Stop was requested after coroutine was suspended, it is resumed once timer is removed )
+     * @details - CANCELLED_EARLY ( Stop was requested before registration finished, timer is removed by awaiter )
+     */
+    enum State : uint8_t { IDLE, ARMED, EXPIRED, EXPIRED_EARLY, CANCELLED, CANCELLED_EARLY };
+
+    /**
+     * @brief - Timer resuming awaiting coroutine
+     */
+    class Node : public Timer {
+    public:
+        Node(SleepAwaitable& awaitable, Clock::time_point expirationTimePoint);
+        /**
+         * @brief - Resume awaiting coroutine, unless waiting was cancelled
+         * @return - Always return delete code, awaitable may be gone once coroutine was resumed
+         */
+        [[nodiscard]] CallbackAction run() override;
+
+    private:
+        SleepAwaitable& m_awaitable;
+    };
+
+    /**
+     * @brief - Called when stop is requested
+     */
+    struct Canceller {
+        SleepAwaitable* awaitable;
+        void operator()() const noexcept { awaitable->cancel(); }
+    };
+
+    Node m_node;
+    std::atomic<State> m_state{IDLE};
+    std::coroutine_handle<> m_handle{};
+    CoroutineExecutor* m_executor;
+    std::stop_token m_stopToken;
+    std::optional<std::stop_callback<Canceller>> m_stopCallback{};
+
+    /**
+     * @brief - Get timer node registered in cache, without owning it
+     */
+    std::shared_ptr<Timer> node();
+    /**
+     * @brief - Resume awaiting coroutine on executor, or on calling thread
+     */
+    void resume();
+    /**
+     * @brief - Remove timer from cache, and resume coroutine once it was removed
+     */
+    void remove();
+    /**
+     * @brief - Cancel waiting, called on thread requesting stop
+     */
+    void cancel() noexcept;
+
+public:
+    /**
+     * @brief - Awaitable constructor
+     * @param expirationTimePoint - Time point until which coroutine waits
+     * @param stopToken - Token cancelling waiting
+     * @param executor - Executor resuming coroutine, nullptr resumes it on timers thread
+     */
+    SleepAwaitable(Clock::time_point expirationTimePoint, std::stop_token stopToken, CoroutineExecutor* executor);
+    SleepAwaitable(const SleepAwaitable&) = delete;
+    SleepAwaitable& operator=(const SleepAwaitable&) = delete;
+    /**
+     * @brief - Check if waiting is not needed, time point passed or stop was already requested
+     */
+    [[nodiscard]] bool await_ready() const noexcept;
+    /**
+     * @brief - Register timer in TimersManager
+     * @param handle - Awaiting coroutine
+     * @return - false if timer already expired, so coroutine is not suspended
+     */
+    bool await_suspend(std::coroutine_handle<> handle);
+    /**
+     * @brief - Finish waiting
+     * @return - true if time point was reached, false if waiting was cancelled
+     */
+    bool await_resume() noexcept;
+};
+
+/**
+ * @brief - Suspend coroutine for duration, co_await returns false if waiting was cancelled
+ * @param duration - Duration of waiting
+ * @param stopToken - Token cancelling waiting
+ * @param executor - Executor resuming coroutine, nullptr resumes it on timers thread
+ */
+[[nodiscard]] SleepAwaitable sleep_for(Clock::duration duration, std::stop_token stopToken = {},
+                                       CoroutineExecutor* executor = nullptr);
+/**
+ * @brief - Suspend coroutine until time point, co_await returns false if waiting was cancelled
+ * @param timePoint - Time point until which coroutine waits
+ * @param stopToken - Token cancelling waiting
+ * @param executor - Executor resuming coroutine, nullptr resumes it on timers thread
+ */
+[[nodiscard]] SleepAwaitable sleep_until(Clock::time_point timePoint, std::stop_token stopToken = {},
+                                         CoroutineExecutor* executor = nullptr);
+
+} // namespace Timers
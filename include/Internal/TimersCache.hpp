@@ -1,20 +1,77 @@
 #pragma once
 #include "Internal/TimersImplementation.hpp"
+#include "Internal/TimersStorage.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <list>
-#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
 #include <thread>
+#include <vector>
 
 namespace Timers {
 
+/**
+ * @brief - Data structures in which TimersCache can keep timers
+ * @details - MULTIMAP ( Ordered multimap, O(log n) registration and removal )
+ * @details - TIMING_WHEEL ( Hierarchical timing wheel, O(1) registration and removal )
+ * @details - HEAP ( Indexed 4-ary heap, O(log n) registration and removal without scanning equal deadlines )
+ */
+enum CacheBackend { MULTIMAP, TIMING_WHEEL, HEAP };
+
 /**
  * @brief - Container storing all registered timers
  */
 class TimersCache {
+public:
+    static constexpr std::chrono::seconds DEFAULT_COMPACTION_INTERVAL{1};
+    /**
+     * @brief - Number of priority lanes, priorities above highest lane share it
+     */
+    static constexpr size_t PRIORITY_LANES = 4;
+
 private:
     /**
-     * @brief Multimap in which expiration time point is key
+     * @brief - Pool from which storage and all other containers of cache allocate their nodes, accessed only by
+     *          thread owning cache. Released nodes are reused, so registering timers does not allocate in steady state
+     */
+    std::pmr::unsynchronized_pool_resource m_pool;
+    /**
+     * @brief - Storage in which timers are kept
+     */
+    std::unique_ptr<TimersStorage> m_storage;
+    /**
+     * @brief - Defines, if any timer with slack was registered, only then expired timers are coalesced
+     */
+    bool m_coalescing{false};
+    /**
+     * @brief - Timers checked for coalescing with current wake up
+     */
+    std::pmr::list<std::shared_ptr<Timer>> m_coalescingCandidates;
+    /**
+     * @brief - Expired timers split by priority lane, reused between passes to avoid allocations
+     */
+    std::pmr::vector<std::pmr::vector<std::shared_ptr<Timer>>> m_lanes;
+    /**
+     * @brief - Number of wake ups, which were avoided by executing timers within their slack
+     */
+    std::atomic<uint64_t> m_savedWakeUps{};
+    /**
+     * @brief - Minimal interval between compactions of lazily cancelled timers, zero disables compaction
+     */
+    Clock::duration m_compactionInterval{DEFAULT_COMPACTION_INTERVAL};
+    /**
+     * @brief - Time point of last compaction
+     */
+    Clock::time_point m_lastCompaction{};
+    /**
+     * @brief - Number of lazy cancellations of all timers, as of last compaction
      */
-    std::multimap<std::chrono::high_resolution_clock::time_point, std::shared_ptr<Timer>> m_timers;
+    uint64_t m_compactedCancellations{};
 
     /**
      * @brief - Check if timer is registered
@@ -23,36 +80,111 @@ private:
      */
     bool isTimerRegistered(std::shared_ptr<Timer> timer);
 public:
+    /**
+     * @brief - Get priority lane of timer's priority
+     * @param priority - Priority of timer
+     * @return - Lane, from zero for lowest priority to PRIORITY_LANES - 1
+     */
+    static constexpr size_t priorityLane(uint32_t priority) { return std::min<size_t>(priority, PRIORITY_LANES - 1); }
+    /**
+     * @brief - Create cache keeping timers in multimap
+     */
+    TimersCache();
+    /**
+     * @brief - Create cache keeping timers in specified backend
+     * @param backend - Data structure in which timers are kept
+     * @param upstream - Memory resource from which pool of cache takes its chunks
+     */
+    explicit TimersCache(CacheBackend backend, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
     /**
      * @brief - If timer is not registered yet, add it to container
+     * @details - Timer taken out of cache is registered once it is returned, so it never runs concurrently with itself
      * @param timer - Timer to register
      */
     void registerTimer(std::shared_ptr<Timer> timer);
+    /**
+     * @brief - Add batch of timers to container, timers which are already registered are skipped
+     * @details - Storage inserts whole batch at once, instead of searching its position for every timer
+     * @param timers - Timers to register
+     * @return - Number of registered timers
+     */
+    size_t registerTimers(std::span<const std::shared_ptr<Timer>> timers);
     /**
      * @brief - Delete timer from container
      * @param timer - Timer to delete
      */
     void deleteTimer(std::shared_ptr<Timer> timer);
     /**
-     * @brief - Restart timer in container
+     * @brief - Delete batch of timers from container
+     * @param timers - Timers to delete
+     */
+    void deleteTimers(std::span<const std::shared_ptr<Timer>> timers);
+    /**
+     * @brief - Restart timer in container, it expires after its duration from now. Not registered timer is registered
+     * @details - Tombstone and requested extension of timer are cleared, so lazily cancelled timer is started again
+     *            Timer taken out of cache is restarted once it is returned
+     * @param timer - Timer to restart
      */
     void restartTimer(std::shared_ptr<Timer> timer);
+    /**
+     * @brief - Remove lazily cancelled timers before their expiration
+     * @details - Whole container is scanned, so it is done only when any timer was cancelled since last compaction,
+     *            and not more often than compaction interval
+     * @param timePoint - Current time point
+     * @return - Number of removed timers
+     */
+    size_t compact(Clock::time_point timePoint);
+    /**
+     * @brief - Set minimal interval between compactions of lazily cancelled timers
+     * @param interval - Interval, zero disables compaction
+     */
+    void setCompactionInterval(Clock::duration interval);
     /**
      * @brief - Get number of registered timers in container
      * @return - number of timers
      */
     [[nodiscard]] size_t size() const;
     /**
-     * @brief - Get closest expiration time point of timer registered in container
+     * @brief - Get closest expiration time point of timer registered in container, delayed by its slack
      * @return - Closest expiration time point
      */
-    [[nodiscard]] std::optional<std::chrono::high_resolution_clock::time_point> getNextExpirationTimePoint();
+    [[nodiscard]] std::optional<Clock::time_point> getNextExpirationTimePoint();
     /**
      * @brief - Get all expired timers, in specified point of time
      * @param timePoint - Time point
-     * @return - All timers from specified point of time
+     * @param resource - Memory resource from which returned list is allocated
+     * @return - All timers from specified point of time, highest priority lane first
+     */
+    [[nodiscard]] std::pmr::list<std::shared_ptr<Timer>> getTimersExpiringAt(Clock::time_point timePoint,
+                                                                            std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    /**
+     * @brief - Remove all timers expiring not later than specified point of time
+     * @details - Following timers, which already reached expiration time point and may still be delayed
+     *            within their slack, are removed together, so they do not require separate wake up.
+     *            Lazily cancelled timers are discarded, and lazily extended ones are registered again
+     * @param timePoint - Time point
+     * @param expiredTimers - Vector to which removed timers are appended, highest priority lane first.
+     *                        Within lane timers keep order of expiration
+     */
+    void extractExpiredTimers(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers);
+    /**
+     * @brief - Mark expired timer as taken out of cache, for execution on other thread
+     * @param timer - Expired timer
+     */
+    void checkOutTimer(const std::shared_ptr<Timer>& timer);
+    /**
+     * @brief - Return timer taken out of cache after its execution
+     * @details - Timer is registered again only if it should keep ticking, and was not deleted meanwhile,
+     *            or if it was started or restarted while it was taken out
+     * @param timer - Executed timer
+     * @param keepRegistered - Defines, if timer should be registered again
+     */
+    void checkInTimer(std::shared_ptr<Timer> timer, bool keepRegistered);
+    /**
+     * @brief - Get number of wake ups, which were avoided by executing timers within their slack
+     * @return - Number of saved wake ups
      */
-    [[nodiscard]] std::list<std::shared_ptr<Timer>> getTimersExpiringAt(std::chrono::high_resolution_clock::time_point timePoint);
+    [[nodiscard]] uint64_t getSavedWakeUps() const;
 };
 
 }
@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace Timers {
+
+/**
+ * @brief - Sources of time, from which Clock reads
+ * @details - STEADY ( Monotonic clock, not affected by system time changes )
+ * @details - COARSE ( Monotonic clock with resolution of scheduler tick, cheaper to read. Steady clock outside of Linux )
+ * @details - VIRTUAL ( Manually advanced clock, for simulations and tests running faster than real time )
+ */
+enum ClockSource { STEADY, COARSE, VIRTUAL };
+
+/**
+ * @brief - Monotonic clock used by all timers, its source is selected at runtime
+ * @details - All sources share epoch of steady clock, so time points stay comparable when source is changed.
+ *            Source should be selected before timers are created.
+ */
+class Clock {
+public:
+    using rep = int64_t;
+    using period = std::nano;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<Clock>;
+    static constexpr bool is_steady = true;
+
+private:
+    static std::atomic<ClockSource> source;
+    /**
+     * @brief - Current time of virtual clock, since epoch
+     */
+    static std::atomic<rep> virtualTime;
+
+    /**
+     * @brief - Read clock, which is not virtual
+     */
+    static time_point readSource(ClockSource clockSource) noexcept;
+
+public:
+    /**
+     * @brief - Get current time point from selected source
+     */
+    static time_point now() noexcept {
+        auto clockSource = source.load(std::memory_order_relaxed);
+        if (clockSource == ClockSource::VIRTUAL) {
+            return time_point{duration{virtualTime.load(std::memory_order_acquire)}};
+        }
+        return readSource(clockSource);
+    }
+    /**
+     * @brief - Select source of time. Virtual clock starts at current steady time
+     * @param clockSource - New source of time
+     */
+    static void setSource(ClockSource clockSource) noexcept;
+    /**
+     * @brief - Get selected source of time
+     */
+    static ClockSource getSource() noexcept;
+    /**
+     * @brief - Get resolution of selected source, zero for steady and virtual clocks
+     */
+    static duration getResolution() noexcept;
+    /**
+     * @brief - Move virtual clock forward
+     * @param step - Duration by which clock is moved, negative durations are ignored
+     */
+    static void advance(duration step) noexcept;
+    /**
+     * @brief - Move virtual clock to time point, clock is never moved backwards
+     * @param timePoint - New time of virtual clock
+     */
+    static void advanceTo(time_point timePoint) noexcept;
+};
+
+} // namespace Timers
@@ -0,0 +1,104 @@
+#pragma once
+#include "Internal/TimersActionsQueue.hpp"
+#include "Internal/TimersCache.hpp"
+#include "Internal/TimersClock.hpp"
+#include "Internal/TimersExecutor.hpp"
+#include "Internal/TimersThreadControl.hpp"
+#include <chrono>
+#include <memory_resource>
+#include <thread>
+
+namespace Timers {
+
+/**
+ * @brief - Defines, how timers are assigned to shards of TimersManager
+ * @details - HASH ( Shard is selected by hash of timer )
+ * @details - THREAD_AFFINITY ( Shard is selected by processor on which starting thread runs )
+ * @details - Shard is selected on first start of timer, timer stays on that shard afterwards
+ */
+enum ShardingPolicy { HASH, THREAD_AFFINITY };
+
+/**
+ * @brief - Configuration of TimersManager, applied on initialization
+ */
+struct TimersConfiguration {
+    /**
+     * @brief - Data structure in which manager keeps registered timers
+     */
+    CacheBackend cacheBackend{CacheBackend::MULTIMAP};
+    /**
+     * @brief - Thread on which callbacks of expired timers are executed
+     */
+    DispatchMode dispatchMode{DispatchMode::INLINE};
+    /**
+     * @brief - Number of worker threads executing callbacks, used in EXECUTOR dispatch mode
+     */
+    size_t executorThreads{std::thread::hardware_concurrency()};
+    /**
+     * @brief - Number of worker threads executing callbacks of timers in priority lanes below bulkLaneThreshold.
+     *          Zero executes them like other timers
+     */
+    size_t bulkExecutorThreads{0};
+    /**
+     * @brief - Lowest priority lane, which is not handed over to bulk executor
+     */
+    size_t bulkLaneThreshold{1};
+    /**
+     * @brief - Number of independent timers threads, each owning its own container and actions queue.
+     *          Zero starts one timers thread per hardware thread
+     */
+    size_t shardsCount{1};
+    /**
+     * @brief - Assignment of timers to shards, used when there is more than one shard
+     */
+    ShardingPolicy shardingPolicy{ShardingPolicy::HASH};
+    /**
+     * @brief - Number of pre-allocated nodes of each actions queue, actions above it are allocated on heap
+     */
+    size_t actionsQueueCapacity{ActionsQueue::DEFAULT_CAPACITY};
+    /**
+     * @brief - Upstream of pools, from which each shard allocates nodes of its timers container, and resource of
+     *          actions above actions queue capacity. Has to be thread-safe and has to outlive manager
+     */
+    std::pmr::memory_resource* memoryResource{std::pmr::new_delete_resource()};
+    /**
+     * @brief - Slack of started timers, which do not have their own slack set
+     */
+    Clock::duration timerSlack{};
+    /**
+     * @brief - Execution budget of callbacks of started timers, which do not have their own budget set.
+     *          Longer executions are reported through Logger and counted, zero disables measurement
+     */
+    Clock::duration executionBudget{};
+    /**
+     * @brief - Number of budget overruns, after which timer is executed on separate slow lane thread.
+     *          Zero keeps slow timers on their thread
+     */
+    uint32_t slowLaneOverruns{0};
+    /**
+     * @brief - Mechanism on which timers threads sleep until next expiration or new action
+     */
+    WaitBackend waitBackend{WaitBackend::CONDITION_VARIABLE};
+    /**
+     * @brief - Source of time of Clock, shared by whole process
+     */
+    ClockSource clockSource{ClockSource::STEADY};
+    /**
+     * @brief - Precision with which timers threads hit expiration time points
+     */
+    WaitMode waitMode{WaitMode::SLEEP};
+    /**
+     * @brief - Interval before expiration time point, which timers threads spend spinning in SPIN wait mode
+     */
+    Clock::duration spinGuard{std::chrono::microseconds(200)};
+    /**
+     * @brief - Defines, if timers threads collect statistics of firing lateness, wake ups and actions
+     */
+    bool collectStatistics{false};
+    /**
+     * @brief - Minimal interval between removals of lazily cancelled timers before their expiration, zero disables it
+     */
+    Clock::duration compactionInterval{TimersCache::DEFAULT_COMPACTION_INTERVAL};
+};
+
+} // namespace Timers
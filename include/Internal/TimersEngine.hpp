@@ -0,0 +1,167 @@
+#pragma once
+#include "Internal/TimersActionsQueue.hpp"
+#include "Internal/TimersCache.hpp"
+#include "Internal/TimersImplementation.hpp"
+#include "Internal/TimersRunner.hpp"
+#include "Internal/TimersShard.hpp"
+#include "Internal/TimersSlab.hpp"
+#include "Internal/TimersStatistics.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace Timers {
+
+/**
+ * @brief - Timers engine without thread of its own, driven by owner's event loop
+ * @details - Timers may be added and erased from any thread, actions are applied and expired timers are executed
+ *            only within poll(), on thread calling it. Engines are independent of each other and of TimersManager.
+ *            Timer added from other thread with earlier expiration moves next deadline at once, and wakes up
+ *            event loop through its wake up callback.
+ */
+class TimersEngine {
+public:
+    /**
+     * @brief - Function waking up event loop, called with new closest expiration time point
+     */
+    using WakeUpCallback = std::function<void(Clock::time_point deadline)>;
+
+private:
+    /**
+     * @brief - Records of timers addressed by handles
+     */
+    TimersSlab m_slab{};
+    /**
+     * @brief - Timers container, actions queue and schedule of slab timers
+     */
+    TimersShard m_shard;
+    /**
+     * @brief - Execution of expired timers
+     */
+    TimersRunner m_runner{};
+    /**
+     * @brief - Closest expiration time point of registered and added timers, in clock ticks. NO_DEADLINE if there are no timers
+     */
+    std::atomic<int64_t> m_nextDeadline;
+    /**
+     * @brief - Function waking up event loop when next deadline moves earlier, empty if there is none
+     */
+    WakeUpCallback m_wakeUp{};
+
+    static constexpr int64_t NO_DEADLINE = INT64_MAX;
+
+    /**
+     * @brief - Publish closest expiration time point of registered timers
+     * @param now - Time point of poll, published if actions were queued meanwhile
+     */
+    void updateNextDeadline(Clock::time_point now);
+    /**
+     * @brief - Move next deadline to expiration time point of added timer, if it is earlier
+     * @param deadline - Expiration time point of added timer
+     * @param wakeUp - Defines, if wake up callback is called when deadline moved
+     */
+    void lowerNextDeadline(Clock::time_point deadline, bool wakeUp);
+
+public:
+    /**
+     * @brief - Engine constructor
+     * @param cacheBackend - Data structure in which engine keeps registered timers
+     * @param actionsQueueCapacity - Number of pre-allocated actions queue nodes
+     * @param collectStatistics - Defines, if poll collects statistics of firing lateness and actions
+     * @param memoryResource - Upstream of pool from which timers container allocates its nodes, and resource of
+     *                         actions above queue capacity. Has to be thread-safe and has to outlive engine
+     */
+    explicit TimersEngine(CacheBackend cacheBackend = CacheBackend::MULTIMAP,
+                          size_t actionsQueueCapacity = ActionsQueue::DEFAULT_CAPACITY, bool collectStatistics = false,
+                          std::pmr::memory_resource* memoryResource = std::pmr::new_delete_resource());
+    TimersEngine(const TimersEngine&) = delete;
+    TimersEngine& operator=(const TimersEngine&) = delete;
+    /**
+     * @brief - Set function waking up event loop, when added timer moves next deadline earlier
+     * @details - Function is called on thread adding timer. It has to be set before timers are added from other threads
+     * @param wakeUp - Function waking up event loop, for example by writing to its eventfd
+     */
+    void setWakeUp(WakeUpCallback wakeUp);
+    /**
+     * @brief - Register new timer, it is started on next poll
+     * @param timer - Timer to register
+     * @param callback - Function called from poll, after timer was registered
+     */
+    void addTimer(std::shared_ptr<Timer> timer, ActionCallback callback = nullptr);
+    /**
+     * @brief - Remove timer, it is stopped on next poll
+     * @param timer - Timer to erase
+     */
+    void eraseTimer(std::shared_ptr<Timer> timer);
+    /**
+     * @brief - Restart timer on next poll, it expires after its duration from then. Lazily cancelled timer is started again
+     * @param timer - Timer to restart
+     */
+    void restartTimer(std::shared_ptr<Timer> timer);
+    /**
+     * @brief - Register batch of timers as single action, they are started on next poll
+     * @param timers - Timers to register
+     * @param callback - Function called from poll, after batch was registered
+     */
+    void addTimers(std::span<const std::shared_ptr<Timer>> timers, ActionCallback callback = nullptr);
+    /**
+     * @brief - Remove batch of timers as single action, they are stopped on next poll
+     * @param timers - Timers to erase
+     */
+    void eraseTimers(std::span<const std::shared_ptr<Timer>> timers);
+    /**
+     * @brief - Create timer addressed by handle
+     * @param callback - Function called on timer expiration, from poll
+     * @param context - Argument of callback
+     * @param interval - Duration of timer ticking, period of repeatable timer
+     * @param repeatable - Defines, if timer keeps ticking after expiration
+     * @return - Handle of created timer
+     */
+    TimerId createTimer(TimerFunction callback, void* context, Clock::duration interval, bool repeatable = false);
+    /**
+     * @brief - Start timer addressed by handle, it expires after its interval from now
+     * @param timerId - Handle of timer
+     */
+    void startTimer(TimerId timerId);
+    /**
+     * @brief - Stop timer addressed by handle
+     * @param timerId - Handle of timer
+     */
+    void stopTimer(TimerId timerId);
+    /**
+     * @brief - Stop and release timer addressed by handle, handle becomes stale
+     * @param timerId - Handle of timer
+     */
+    void destroyTimer(TimerId timerId);
+    /**
+     * @brief - Get closest expiration time point, of timers registered by last poll and timers added since.
+     *          Lock-free, may be called from any thread
+     * @return - Closest expiration time point, std::nullopt if there are no timers
+     */
+    [[nodiscard]] std::optional<Clock::time_point> nextDeadline() const;
+    /**
+     * @brief - Check if there are added or erased timers, which will be applied on next poll
+     */
+    [[nodiscard]] bool hasPendingActions() const;
+    /**
+     * @brief - Apply pending actions, and execute all timers expired until time point
+     * @param now - Current time point
+     * @return - Number of executed timers
+     */
+    size_t poll(Clock::time_point now = Clock::now());
+    /**
+     * @brief - Get number of registered timers, both shared and addressed by handles
+     */
+    [[nodiscard]] size_t size() const;
+    /**
+     * @brief - Get statistics collected by poll, may be called from any thread
+     * @return - Statistics, wake ups are not counted as engine does not wait
+     */
+    [[nodiscard]] TimersStatisticsSnapshot getStatistics() const;
+};
+
+} // namespace Timers
@@ -0,0 +1,105 @@
+#pragma once
+#include "Internal/TimersImplementation.hpp"
+#include "Internal/TimersThreadSettings.hpp"
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Timers {
+
+/**
+ * @brief - Defines, on which thread callbacks of expired timers are executed
+ * @details - INLINE ( Callbacks are executed directly on timers thread )
+ * @details - EXECUTOR ( Callbacks are handed over to pool of worker threads, timers thread only keeps time )
+ */
+enum DispatchMode { INLINE, EXECUTOR };
+
+/**
+ * @brief - Fixed pool of worker threads executing callbacks of expired timers
+ * @details - Dispatched timers are executed in order of their priority, and dispatching order among equal priorities
+ */
+class TimersExecutor {
+public:
+    /**
+     * @brief - Function called on worker thread, after timer's callback was executed, with owner which dispatched timer
+     */
+    using CompletionHandler = std::function<void(std::shared_ptr<Timer> timer, Timer::CallbackAction callbackAction, size_t owner)>;
+
+private:
+    /**
+     * @brief - Timer waiting for execution
+     */
+    struct Task {
+        uint32_t priority;
+        uint64_t sequence;
+        std::shared_ptr<Timer> timer;
+        size_t owner;
+        bool operator<(const Task& other) const {
+            return priority != other.priority ? priority < other.priority : sequence > other.sequence;
+        }
+    };
+
+    /**
+     * @brief - Number of worker threads
+     */
+    size_t m_threadsCount;
+    /**
+     * @brief - Called after every executed timer
+     */
+    CompletionHandler m_completionHandler;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    /**
+     * @brief - Timers waiting for execution, highest priority on top
+     */
+    std::priority_queue<Task> m_tasks{};
+    /**
+     * @brief - Sequence number of next dispatched timer
+     */
+    uint64_t m_sequence{};
+    /**
+     * @brief - Defines, if workers should keep waiting for new tasks
+     */
+    bool m_running{false};
+    std::vector<std::thread> m_workers{};
+
+    /**
+     * @brief - Worker thread loop
+     */
+    void work();
+
+public:
+    /**
+     * @brief - Executor constructor
+     * @param threadsCount - Number of worker threads, at least one is always started
+     * @param completionHandler - Function called after every executed timer
+     */
+    TimersExecutor(size_t threadsCount, CompletionHandler completionHandler);
+    /**
+     * @brief - Executor destructor, stops worker threads
+     */
+    ~TimersExecutor();
+    TimersExecutor(const TimersExecutor&) = delete;
+    TimersExecutor& operator=(const TimersExecutor&) = delete;
+    /**
+     * @brief - Start worker threads
+     * @param settings - Settings applied by every worker thread, before it takes first timer
+     */
+    void start(const ThreadSettings& settings = {});
+    /**
+     * @brief - Stop worker threads, after all dispatched timers are executed
+     */
+    void stop();
+    /**
+     * @brief - Hand over expired timers to workers
+     * @param timers - Expired timers, in order of dispatching
+     * @param owner - Index of dispatching shard, passed to completion handler
+     */
+    void dispatch(std::vector<std::shared_ptr<Timer>>& timers, size_t owner = 0);
+};
+
+} // namespace Timers
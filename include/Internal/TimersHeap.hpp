@@ -0,0 +1,58 @@
+#pragma once
+#include "Internal/TimersIndexedHeap.hpp"
+#include "Internal/TimersStorage.hpp"
+#include <vector>
+
+namespace Timers {
+
+/**
+ * @brief - Indexed d-ary min-heap storage
+ * @details - Timers are kept in contiguous vector together with their expiration time points. Every timer remembers
+ *            its own index in heap, so removal and membership checks cost O(log n) and O(1), without scanning.
+ */
+class TimersHeap : public TimersStorage {
+public:
+    static constexpr size_t ARITY = 4;
+
+private:
+    /**
+     * @brief - Heap node, expiration time point is copied to avoid touching timer while comparing
+     */
+    struct Node {
+        Clock::time_point expirationTimePoint;
+        std::shared_ptr<Timer> timer;
+    };
+    /**
+     * @brief - Stores index of node in timer
+     */
+    struct NodePosition {
+        void operator()(Node& node, size_t index) const { positionOf(*node.timer).index = index; }
+    };
+    /**
+     * @brief - Heap nodes
+     */
+    IndexedHeap<Node, NodePosition, ARITY> m_nodes;
+    /**
+     * @brief - Indexes of nodes to visit, reused while collecting expired timers
+     */
+    std::pmr::vector<size_t> m_pending;
+
+public:
+    /**
+     * @brief - Heap storage constructor
+     * @param resource - Memory resource from which heap nodes are allocated
+     */
+    explicit TimersHeap(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    void insert(std::shared_ptr<Timer> timer) override;
+    size_t insertBatch(std::span<const std::shared_ptr<Timer>> timers) override;
+    bool erase(const std::shared_ptr<Timer>& timer) override;
+    size_t eraseIf(bool (*predicate)(Timer&)) override;
+    [[nodiscard]] bool contains(const std::shared_ptr<Timer>& timer) const override;
+    [[nodiscard]] size_t size() const override;
+    [[nodiscard]] std::optional<Clock::time_point> nextExpirationTimePoint() override;
+    void collectExpiringAt(Clock::time_point timePoint, std::pmr::list<std::shared_ptr<Timer>>& expiredTimers) override;
+    void extractExpired(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) override;
+};
+
+} // namespace Timers
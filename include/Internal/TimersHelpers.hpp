@@ -4,8 +4,17 @@
 namespace Timers {
 
 TimerPtr makeOneShotTimer();
-TimerPtr makeOneShotTimer(const std::function<void()>&);
-TimerPtr makeOneShotTimer(const std::function<void()>&, std::chrono::high_resolution_clock::duration);
-TimerPtr makeOneShotTimer(const std::function<void()>&, std::chrono::high_resolution_clock::time_point);
+template <TimerCallable Callable>
+TimerPtr makeOneShotTimer(Callable&& callback) {
+    return std::make_shared<OneShotTimer>(std::forward<Callable>(callback));
+}
+template <TimerCallable Callable>
+TimerPtr makeOneShotTimer(Callable&& callback, Clock::duration duration) {
+    return std::make_shared<OneShotTimer>(std::forward<Callable>(callback), duration);
+}
+template <TimerCallable Callable>
+TimerPtr makeOneShotTimer(Callable&& callback, Clock::time_point expirationTimePoint) {
+    return std::make_shared<OneShotTimer>(std::forward<Callable>(callback), expirationTimePoint);
+}
 
-} // namespace Timers
\ No newline at end of file
+} // namespace Timers
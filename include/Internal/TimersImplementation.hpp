@@ -1,32 +1,152 @@
 #pragma once
+#include "Internal/TimersClock.hpp"
+#include "Internal/TimersInplaceFunction.hpp"
+#include <atomic>
 #include <chrono>
-#include <functional>
+#include <concepts>
+#include <cstdint>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <utility>
 
 namespace Timers {
 
+/**
+ * @brief - Callback function called on timer expiration, typical lambdas are kept without allocation
+ */
+using TimerCallback = InplaceFunction<void()>;
+
+/**
+ * @brief - Any callable from which timer's callback can be created
+ */
+template <typename Callable>
+concept TimerCallable = std::constructible_from<TimerCallback, Callable>;
+
 /**
  * @brief - Interface class for timer's functionality
  */
 class Timer : public std::enable_shared_from_this<Timer> {
 public:
-    static constexpr bool DEFAULT_TIMER_RUNNING = false;
     static constexpr uint32_t DEFAULT_TIMER_PRIORITY = 0;
+    /**
+     * @brief - State of timer started by start() or startAsync()
+     * @details - IDLE ( Timer is not registered )
+     * @details - PENDING_START ( Start action is queued on timers thread )
+     * @details - ARMED ( Timer is registered, and waits for expiration )
+     * @details - FIRING ( Timer's callback is being executed )
+     * @details - PENDING_STOP ( Stop action is queued on timers thread )
+     */
+    enum State : uint8_t { IDLE, PENDING_START, ARMED, FIRING, PENDING_STOP };
+    /**
+     * @brief - Actions, which are returned from callback's.
+     * @details - NONE ( Keep timer registered, at its current expiration time point )
+     * @details - DELETE ( Remove this timer from cache )
+     */
+    enum CallbackAction { NONE, DELETE };
 
 private:
+    friend class TimersCache;
+    friend class TimersEngine;
+    friend class TimersManager;
+    friend class TimersStorage;
+    friend class TimersRunner;
+    friend class TimersExecutor;
+    friend class SleepAwaitable;
     /**
-     * @brief - Set timer running variable
+     * @brief - Position of timer inside of cache storage, maintained only by storage backends
      */
-    void setRunningState(const bool& newState);
-
-protected:
+    struct CachePosition {
+        std::size_t slot{};
+        std::size_t index{};
+    } cachePosition{};
+    /**
+     * @brief - Defines, if timer was taken out of cache to be executed on other thread
+     * @details - Flags of checked out timer are accessed only by thread of its shard, which never changes
+     */
+    bool checkedOut{false};
+    /**
+     * @brief - Defines, if timer was deleted while it was taken out of cache
+     */
+    bool deletedWhileCheckedOut{false};
+    /**
+     * @brief - Defines, if timer was started again while it was taken out of cache, it is registered once it is returned
+     */
+    bool startedWhileCheckedOut{false};
+    /**
+     * @brief - Defines, if timer was restarted while it was taken out of cache, it is restarted once it is returned
+     */
+    bool restartedWhileCheckedOut{false};
+    /**
+     * @brief - Defines, if timer is executed on timers thread also when callbacks are handed over to executor
+     */
+    bool dispatchInline{false};
+    /**
+     * @brief - Index of TimersManager shard to which timer was assigned on its first start, NO_SHARD before it.
+     *          Set once, so timer is never moved while its shard keeps it registered or checked out
+     */
+    static constexpr size_t NO_SHARD = SIZE_MAX;
+    std::atomic<size_t> shardIndex{NO_SHARD};
+    /**
+     * @brief - Expiration time point requested by lazy extension, in clock ticks since epoch. Zero if none was requested
+     */
+    std::atomic<Clock::rep> extendedExpiration{0};
+    /**
+     * @brief - Tombstone of lazy cancellation, cancelled timer is discarded when it expires or when cache is compacted
+     */
+    std::atomic<bool> cancelled{false};
     /**
-     * @brief - Indicates if is running or not
-     *          Timer should not be changed while it's running
+     * @brief - Number of lazy cancellations of all timers, caches compact their tombstones only when it changes
      */
-    bool running{DEFAULT_TIMER_RUNNING};
+    static std::atomic<uint64_t> cancellations;
+    /**
+     * @brief - Number of executions of this timer, which exceeded its execution budget
+     */
+    std::atomic<uint32_t> overruns{0};
+    /**
+     * @brief - Number of executions of all timers, which exceeded their execution budget
+     */
+    static std::atomic<uint64_t> totalOverruns;
+    /**
+     * @brief - Report execution, which exceeded execution budget
+     * @param executionTime - Duration of callback's execution
+     */
+    void reportOverrun(Clock::duration executionTime) noexcept;
+    /**
+     * @brief - State of timer, waited on with futex by synchronous start and stop
+     */
+    std::atomic<State> state{IDLE};
+    /**
+     * @brief - Move timer from expected state to new one, and wake up threads waiting for it
+     * @return - true if timer was in expected state
+     */
+    bool settle(State expected, State newState) noexcept;
+    /**
+     * @brief - Wait until timer leaves state
+     * @return - New state of timer
+     */
+    State waitWhile(State current) const noexcept;
+    /**
+     * @brief - Execute timer's callback, and keep state of started timer
+     * @details - Timer which was not started by start() or startAsync() is not touched once its callback was executed
+     * @return - Code returned by callback
+     */
+    CallbackAction fire();
+    /**
+     * @brief - Clear tombstone and requested extension, before timer is started again
+     */
+    void revive() noexcept;
+    /**
+     * @brief - Release timer discarded at its tombstone, timer started by start() or startAsync() becomes idle
+     */
+    void discard() noexcept;
+    /**
+     * @brief - Send action starting timer, which was moved to PENDING_START
+     * @param previous - State from which timer was moved, lazily cancelled ARMED timer is restarted
+     */
+    void requestStart(State previous);
+
+protected:
     /**
      * @brief - Priority of this timer, depending on it order of timers execuration is created
      */
@@ -34,23 +154,30 @@ protected:
     /**
      * @brief - Callback function called on timer expiration
      */
-    std::function<void()> callback{nullptr};
+    TimerCallback callback{nullptr};
     /**
      * @brief - Point of time in which timer started ticking ( default is timer creation time )
      */
-    std::chrono::high_resolution_clock::time_point startTimePoint{std::chrono::high_resolution_clock::now()};
+    Clock::time_point startTimePoint{Clock::now()};
     /**
      * @brief - Duration of timer ticking
      */
-    std::chrono::high_resolution_clock::duration duration{};
-
-public:
+    Clock::duration duration{};
     /**
-     * @brief - Actions, which are returned from callback's.
-     * @details - NONE ( No actions are required )
-     * @details - DELETE ( Remove this timer from cache )
+     * @brief - Delay after expiration time point, which timer tolerates. Unset timer slack is taken from TimersManager
      */
-    enum CallbackAction { NONE, DELETE };
+    std::optional<Clock::duration> slack{};
+    /**
+     * @brief - Longest expected duration of callback's execution. Unset budget is taken from TimersManager
+     */
+    std::optional<Clock::duration> executionBudget{};
+    /**
+     * @brief - Time point of timers thread pass, in which timer was taken out of cache for execution
+     * @details - Lets timers compute their next expiration without reading clock again in callback
+     */
+    Clock::time_point firingTimePoint{};
+
+public:
     /**
      * @brief - Default timer interface constructor
      */
@@ -59,19 +186,24 @@ public:
      * @brief - Timer interface constructor
      * @param callback - Callback function called on timer expiration
      */
-    explicit Timer(std::function<void()> callback);
+    template <TimerCallable Callable>
+    explicit Timer(Callable&& callback) : callback{std::forward<Callable>(callback)} {}
     /**
      * @brief - Timer interface constructor
      * @param callback - Callback function called on timer expiration
      * @param duration - Duration of timer ticking
      */
-    Timer(std::function<void()> callback, std::chrono::high_resolution_clock::duration duration);
+    template <TimerCallable Callable>
+    Timer(Callable&& callback, Clock::duration duration)
+        : callback{std::forward<Callable>(callback)}, duration{duration} {}
     /**
      * @brief - Timer interface constructor
      * @param callback - Callback function called on timer expiration
      * @param expirationTime - Point in time in which timer should expire
      */
-    Timer(std::function<void()> callback, std::chrono::high_resolution_clock::time_point expirationTime);
+    template <TimerCallable Callable>
+    Timer(Callable&& callback, Clock::time_point expirationTime)
+        : callback{std::forward<Callable>(callback)}, duration{expirationTime - startTimePoint} {}
     /**
      * @brief - Restart timer with current time point
      */
@@ -85,14 +217,54 @@ public:
      * @brief - set callback function
      * @param callback - Callback function called on timer expiration
      */
-    void setCallback(std::function<void()> callback);
+    template <TimerCallable Callable>
+    void setCallback(Callable&& callback) {
+        this->callback = TimerCallback{std::forward<Callable>(callback)};
+    }
     /**
      * @brief - Get time point in which timer will expire
      * @return - Expiration time point
      */
-    [[nodiscard]] std::chrono::high_resolution_clock::time_point getExpirationTimePoint() const;
+    [[nodiscard]] Clock::time_point getExpirationTimePoint() const;
+    /**
+     * @brief - Get latest time point in which timer has to be executed, expiration time point delayed by slack
+     * @return - Latest expiration time point
+     */
+    [[nodiscard]] Clock::time_point getLatestExpirationTimePoint() const;
+    /**
+     * @brief - Set delay after expiration time point, which timer tolerates. Timers expiring within each other's slack
+     *          are executed together, in single wake up of timers thread. Slack must not be changed while timer is running
+     * @param slack - Tolerated delay
+     */
+    void setSlack(Clock::duration slack);
+    /**
+     * @brief - Get delay after expiration time point, which timer tolerates
+     * @return - Tolerated delay, zero if it was not set
+     */
+    [[nodiscard]] Clock::duration getSlack() const;
+    /**
+     * @brief - Set longest expected duration of callback's execution, longer executions are reported as overruns.
+     *          Budget must not be changed while timer is running
+     * @param budget - Execution budget, zero disables measurement of this timer
+     */
+    void setExecutionBudget(Clock::duration budget);
+    /**
+     * @brief - Get longest expected duration of callback's execution
+     * @return - Execution budget, zero if it was not set
+     */
+    [[nodiscard]] Clock::duration getExecutionBudget() const;
+    /**
+     * @brief - Get number of executions of this timer, which exceeded its execution budget
+     */
+    [[nodiscard]] uint32_t getOverruns() const noexcept;
     /**
-     * @brief - Set new priority of timer
+     * @brief - Get number of executions of all timers, which exceeded their execution budget
+     */
+    [[nodiscard]] static uint64_t getTotalOverruns() noexcept;
+    /**
+     * @brief - Set new priority of timer, it selects priority lane in which expired timer is executed
+     * @details - Lanes of higher priority are executed first among all expired timers, priorities above
+     *            highest lane share it
      * @param priority - new priority of timer
      */
     void setPriority(uint32_t priority) noexcept;
@@ -105,13 +277,36 @@ public:
      * @brief - Set new expiration time point of timer
      * @param timePoint - new expiration time point
      */
-    void setExpirationTimePoint(std::chrono::high_resolution_clock::time_point timePoint);
+    void setExpirationTimePoint(Clock::time_point timePoint);
     /**
      * @brief - Get duration
      */
-    std::chrono::high_resolution_clock::duration getDuration() const;
+    Clock::duration getDuration() const;
     /**
-     * @brief - Timer start working
+     * @brief - Lazily move expiration of started timer to later time point, without any action on timers thread
+     * @details - Only atomic maximum is taken. Timers thread moves timer when its previous expiration time point is reached,
+     *            so expiration can not be moved earlier this way. Can be called from any thread, also from callbacks
+     * @param expirationTimePoint - New expiration time point, ignored if it is not later than current one,
+     *                              or than extension already requested
+     */
+    void extendTo(Clock::time_point expirationTimePoint) noexcept;
+    /**
+     * @brief - Lazily move expiration of started timer to one duration from now, typical for idle timeouts
+     */
+    void extend() noexcept;
+    /**
+     * @brief - Lazily cancel started timer, without any action on timers thread
+     * @details - Only tombstone is set. Timer is discarded instead of being executed, when it expires or when
+     *            cache is compacted, and becomes idle. Starting or restarting timer again clears tombstone,
+     *            timer then expires after its duration from now
+     */
+    void cancel() noexcept;
+    /**
+     * @brief - Check if timer was lazily cancelled
+     */
+    [[nodiscard]] bool isCancelled() const noexcept;
+    /**
+     * @brief - Timer start working, waits until timers thread registered it
      */
     void start();
     /**
@@ -119,9 +314,19 @@ public:
      */
     void startAsync();
     /**
-     * @brief - Timer stop working
+     * @brief - Timer stop working, waits until timers thread removed it
+     * @details - Must not be called from timer's own callback, executed on timers thread
      */
     void stop();
+    /**
+     * @brief - Get state of timer started by start() or startAsync()
+     */
+    [[nodiscard]] State getState() const noexcept;
+    /**
+     * @brief - Check if timer is started, or its start is pending
+     * @details - Timer should not be changed while it's running
+     */
+    [[nodiscard]] bool isRunning() const noexcept;
 };
 
 #define TimerPtr std::shared_ptr<Timer>
@@ -139,19 +344,24 @@ public:
      * @brief - One shot timer constructor
      * @param callback - Callback function called on timer expiration
      */
-    explicit OneShotTimer(std::function<void()> callback);
+    template <TimerCallable Callable>
+    explicit OneShotTimer(Callable&& callback) : Timer(std::forward<Callable>(callback)) {}
     /**
      * @brief - One shot timer constructor
      * @param callback - Callback function called on timer expiration
      * @param duration - Duration of timer ticking
      */
-    OneShotTimer(std::function<void()> callback, std::chrono::high_resolution_clock::duration duration);
+    template <TimerCallable Callable>
+    OneShotTimer(Callable&& callback, Clock::duration duration)
+        : Timer(std::forward<Callable>(callback), duration) {}
     /**
      * @brief - One shot timer constructor
      * @param callback - Callback function called on timer expiration
      * @param expirationTime - Point in time in which timer should expire
      */
-    OneShotTimer(std::function<void()> callback, std::chrono::high_resolution_clock::time_point expirationTime);
+    template <TimerCallable Callable>
+    OneShotTimer(Callable&& callback, Clock::time_point expirationTime)
+        : Timer(std::forward<Callable>(callback), expirationTime) {}
     /**
      * @brief - Executes callback function
      * @return - Always return delete code for one shot timer
@@ -163,11 +373,53 @@ public:
  * @brief - Timer's class which are intended to be repeatable
  */
 class RepeatableTimer : public Timer {
+public:
+    /**
+     * @brief - How next expiration time point of repeatable timer is scheduled
+     * @details - FIXED_RATE ( Expirations are kept on grid of start time point + n * period, callback time does not drift it )
+     * @details - FIXED_DELAY ( Next expiration is one period after callback completes )
+     */
+    enum ScheduleMode { FIXED_RATE, FIXED_DELAY };
+    /**
+     * @brief - What fixed rate timer does with periods missed because it was executed late
+     * @details - BURST ( Execute every missed period, one after another, until timer catches up )
+     * @details - SKIP ( Execute once, missed periods are dropped and not counted )
+     * @details - COALESCE ( Execute once for all missed periods, which are counted as expirations )
+     */
+    enum CatchUpPolicy { BURST, SKIP, COALESCE };
+
 protected:
     /**
      * @brief - Expiration's counter
      */
     uint32_t expirationCount{};
+    /**
+     * @brief - Number of periods covered by last execution, more than one only for coalesced periods
+     */
+    uint32_t lastCoalescedCount{};
+    /**
+     * @brief - How next expiration time point is scheduled
+     */
+    ScheduleMode scheduleMode{FIXED_RATE};
+    /**
+     * @brief - What fixed rate timer does with missed periods
+     */
+    CatchUpPolicy catchUpPolicy{BURST};
+    /**
+     * @brief - Fixed rate grid, expiration n is at anchor + ( n + 1 ) * duration, all kept in clock ticks
+     * @details - Grid is anchored again whenever start time point was moved from outside, e.g. by restart or extension
+     */
+    Clock::rep anchorTicks{};
+    /**
+     * @brief - Index of period, which ends at current start time point of fixed rate grid
+     */
+    uint64_t periodIndex{};
+
+    /**
+     * @brief - Move start time point to begin of next period, according to schedule mode and catch up policy
+     * @return - Number of periods covered by current execution
+     */
+    uint32_t schedule();
 
 public:
     RepeatableTimer() = default;
@@ -175,21 +427,26 @@ public:
      * @brief - Repeatable timer constructor
      * @param callback - Callback function called on timer expiration
      */
-    explicit RepeatableTimer(std::function<void()> callback);
+    template <TimerCallable Callable>
+    explicit RepeatableTimer(Callable&& callback) : Timer(std::forward<Callable>(callback)) {}
     /**
      * @brief - Repeatable timer constructor
      * @param callback - Callback function called on timer expiration
      * @param duration - Duration of timer ticking
      */
-    RepeatableTimer(std::function<void()> callback, std::chrono::high_resolution_clock::duration duration);
+    template <TimerCallable Callable>
+    RepeatableTimer(Callable&& callback, Clock::duration duration)
+        : Timer(std::forward<Callable>(callback), duration) {}
     /**
      * @brief - Repeatable timer constructor
      * @param callback - Callback function called on timer expiration
      * @param expirationTime - Point in time in which timer should expire
      */
-    RepeatableTimer(std::function<void()> callback, std::chrono::high_resolution_clock::time_point expirationTime);
+    template <TimerCallable Callable>
+    RepeatableTimer(Callable&& callback, Clock::time_point expirationTime)
+        : Timer(std::forward<Callable>(callback), expirationTime) {}
     /**
-     * @brief - Executes callback function
+     * @brief - Executes callback function, and moves expiration time point to next period
      * @return - Always return none code for repeatable timer
      */
     [[nodiscard]] CallbackAction run() override;
@@ -198,6 +455,29 @@ public:
      * @return - timer expiration count
      */
     [[nodiscard]] uint32_t getExpirationsCount() const;
+    /**
+     * @brief - Get number of periods covered by last execution, can be read from callback
+     * @return - One, or number of coalesced periods for COALESCE policy
+     */
+    [[nodiscard]] uint32_t getLastCoalescedCount() const;
+    /**
+     * @brief - Set how next expiration time point is scheduled, must not be changed while timer is running
+     * @param mode - Schedule mode
+     */
+    void setScheduleMode(ScheduleMode mode) noexcept;
+    /**
+     * @brief - Get how next expiration time point is scheduled
+     */
+    [[nodiscard]] ScheduleMode getScheduleMode() const;
+    /**
+     * @brief - Set what fixed rate timer does with missed periods, must not be changed while timer is running
+     * @param policy - Catch up policy
+     */
+    void setCatchUpPolicy(CatchUpPolicy policy) noexcept;
+    /**
+     * @brief - Get what fixed rate timer does with missed periods
+     */
+    [[nodiscard]] CatchUpPolicy getCatchUpPolicy() const;
 };
 
 } // namespace Timers
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <memory_resource>
+#include <vector>
+
+namespace Timers {
+
+/**
+ * @brief - d-ary min-heap ordered by expiration time point, reporting every node move
+ * @details - Node has to provide expirationTimePoint member. Position is called with node and its new index
+ *            whenever node is stored in heap, so node owner can find it later without scanning.
+ */
+template <typename Node, typename Position, size_t Arity = 4>
+class IndexedHeap {
+public:
+    static constexpr size_t ARITY = Arity;
+
+private:
+    std::pmr::vector<Node> m_nodes;
+    Position m_position;
+
+    void setNode(size_t index, Node node) {
+        m_position(node, index);
+        m_nodes[index] = std::move(node);
+    }
+
+    void siftUp(size_t index) {
+        Node node = std::move(m_nodes[index]);
+        while (index > 0) {
+            auto parent = (index - 1) / ARITY;
+            if (!(node.expirationTimePoint < m_nodes[parent].expirationTimePoint)) {
+                break;
+            }
+            setNode(index, std::move(m_nodes[parent]));
+            index = parent;
+        }
+        setNode(index, std::move(node));
+    }
+
+    void siftDown(size_t index) {
+        Node node = std::move(m_nodes[index]);
+        while (true) {
+            auto firstChild = index * ARITY + 1;
+            if (firstChild >= m_nodes.size()) {
+                break;
+            }
+            auto lastChild = std::min(firstChild + ARITY, m_nodes.size());
+            auto smallest = firstChild;
+            for (auto child = firstChild + 1; child < lastChild; ++child) {
+                if (m_nodes[child].expirationTimePoint < m_nodes[smallest].expirationTimePoint) {
+                    smallest = child;
+                }
+            }
+            if (!(m_nodes[smallest].expirationTimePoint < node.expirationTimePoint)) {
+                break;
+            }
+            setNode(index, std::move(m_nodes[smallest]));
+            index = smallest;
+        }
+        setNode(index, std::move(node));
+    }
+
+public:
+    explicit IndexedHeap(Position position = Position{}) : IndexedHeap(std::pmr::get_default_resource(), std::move(position)) {}
+    /**
+     * @brief - Create heap allocating its nodes from memory resource
+     */
+    explicit IndexedHeap(std::pmr::memory_resource* resource, Position position = Position{})
+        : m_nodes{resource}, m_position{std::move(position)} {}
+
+    [[nodiscard]] bool empty() const { return m_nodes.empty(); }
+    [[nodiscard]] size_t size() const { return m_nodes.size(); }
+    [[nodiscard]] const Node& top() const { return m_nodes.front(); }
+    [[nodiscard]] const Node& operator[](size_t index) const { return m_nodes[index]; }
+
+    /**
+     * @brief - Add node to heap
+     */
+    void push(Node node) {
+        m_nodes.push_back(std::move(node));
+        siftUp(m_nodes.size() - 1);
+    }
+    /**
+     * @brief - Add node at the end of heap without ordering it, restore has to be called before heap is used
+     */
+    void append(Node node) {
+        m_nodes.push_back(std::move(node));
+        m_position(m_nodes.back(), m_nodes.size() - 1);
+    }
+    /**
+     * @brief - Order nodes appended since index
+     * @details - When appended nodes outnumber ordered ones, whole heap is rebuilt bottom-up in linear time,
+     *            otherwise appended nodes are sifted up one by one
+     * @param firstAppended - Index of first appended node
+     */
+    void restore(size_t firstAppended) {
+        if (m_nodes.size() - firstAppended > firstAppended) {
+            for (auto index = m_nodes.size() > 1 ? (m_nodes.size() - 2) / ARITY + 1 : 0; index > 0; --index) {
+                siftDown(index - 1);
+            }
+        } else {
+            for (auto index = firstAppended; index < m_nodes.size(); ++index) {
+                siftUp(index);
+            }
+        }
+    }
+    /**
+     * @brief - Remove all nodes matching predicate, and rebuild heap
+     * @return - Number of removed nodes
+     */
+    template <typename Predicate>
+    size_t eraseIf(Predicate predicate) {
+        auto end = std::remove_if(std::begin(m_nodes), std::end(m_nodes), predicate);
+        auto erased = static_cast<size_t>(std::end(m_nodes) - end);
+        if (erased > 0) {
+            m_nodes.erase(end, std::end(m_nodes));
+            for (size_t index = 0; index < m_nodes.size(); ++index) {
+                m_position(m_nodes[index], index);
+            }
+            restore(0);
+        }
+        return erased;
+    }
+    /**
+     * @brief - Reserve space for nodes
+     */
+    void reserve(size_t capacity) { m_nodes.reserve(capacity); }
+    /**
+     * @brief - Remove node at index from heap
+     * @return - Removed node
+     */
+    Node erase(size_t index) {
+        Node removed = std::move(m_nodes[index]);
+        auto last = m_nodes.size() - 1;
+        if (index != last) {
+            setNode(index, std::move(m_nodes[last]));
+            m_nodes.pop_back();
+            update(index, removed.expirationTimePoint);
+        } else {
+            m_nodes.pop_back();
+        }
+        return removed;
+    }
+    /**
+     * @brief - Remove node with earliest expiration time point
+     * @return - Removed node
+     */
+    Node pop() { return erase(0); }
+    /**
+     * @brief - Change expiration time point of node at index, keeping it in heap
+     */
+    template <typename TimePoint>
+    void rekey(size_t index, TimePoint expirationTimePoint) {
+        auto previous = m_nodes[index].expirationTimePoint;
+        m_nodes[index].expirationTimePoint = expirationTimePoint;
+        update(index, previous);
+    }
+
+private:
+    template <typename TimePoint>
+    void update(size_t index, TimePoint previousExpirationTimePoint) {
+        if (m_nodes[index].expirationTimePoint < previousExpirationTimePoint) {
+            siftUp(index);
+        } else {
+            siftDown(index);
+        }
+    }
+};
+
+} // namespace Timers
@@ -0,0 +1,142 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifndef TIMERS_CALLBACK_INLINE_CAPACITY
+#define TIMERS_CALLBACK_INLINE_CAPACITY 48
+#endif
+
+namespace Timers {
+
+template <typename Signature, size_t Capacity = TIMERS_CALLBACK_INLINE_CAPACITY>
+class InplaceFunction;
+
+template <typename Callable>
+struct IsStdFunction : std::false_type {};
+template <typename Signature>
+struct IsStdFunction<std::function<Signature>> : std::true_type {};
+
+/**
+ * @brief - Move-only callable wrapper, keeping callables up to Capacity bytes inside of itself
+ * @details - Larger callables, or ones which may throw on move, are kept on heap. Unlike std::function
+ *            wrapped callable does not have to be copyable, and typical lambdas are never allocated.
+ */
+template <typename Result, typename... Args, size_t Capacity>
+class InplaceFunction<Result(Args...), Capacity> {
+public:
+    static constexpr size_t CAPACITY = Capacity;
+
+private:
+    /**
+     * @brief - Operations of wrapped callable, one static table per callable type
+     */
+    struct Operations {
+        Result (*invoke)(void* storage, Args&&... args);
+        /**
+         * @brief - Move callable from source storage to destination storage, and destroy source
+         */
+        void (*relocate)(void* destination, void* source) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template <typename Callable>
+    static constexpr bool isStoredInline = sizeof(Callable) <= Capacity && alignof(Callable) <= alignof(std::max_align_t) &&
+                                           std::is_nothrow_move_constructible_v<Callable>;
+
+    template <typename Callable>
+    static constexpr Operations inlineOperations{
+        [](void* storage, Args&&... args) -> Result {
+            return std::invoke(*std::launder(static_cast<Callable*>(storage)), std::forward<Args>(args)...);
+        },
+        [](void* destination, void* source) noexcept {
+            auto callable = std::launder(static_cast<Callable*>(source));
+            ::new (destination) Callable(std::move(*callable));
+            callable->~Callable();
+        },
+        [](void* storage) noexcept { std::launder(static_cast<Callable*>(storage))->~Callable(); }};
+
+    template <typename Callable>
+    static constexpr Operations heapOperations{
+        [](void* storage, Args&&... args) -> Result {
+            return std::invoke(**static_cast<Callable**>(storage), std::forward<Args>(args)...);
+        },
+        [](void* destination, void* source) noexcept {
+            ::new (destination) Callable*(*static_cast<Callable**>(source));
+        },
+        [](void* storage) noexcept { delete *static_cast<Callable**>(storage); }};
+
+    alignas(std::max_align_t) std::byte m_storage[Capacity < sizeof(void*) ? sizeof(void*) : Capacity];
+    const Operations* m_operations{nullptr};
+
+    void reset() noexcept {
+        if (m_operations) {
+            m_operations->destroy(m_storage);
+            m_operations = nullptr;
+        }
+    }
+
+public:
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+    /**
+     * @brief - Wrap callable, moving or copying it depending on passed reference
+     * @param callable - Any callable invocable with Args
+     */
+    template <typename Callable>
+        requires(!std::is_same_v<std::remove_cvref_t<Callable>, InplaceFunction> &&
+                 std::is_invocable_r_v<Result, std::decay_t<Callable>&, Args...>)
+    InplaceFunction(Callable&& callable) {
+        using Stored = std::decay_t<Callable>;
+        if constexpr (std::is_pointer_v<Stored> || std::is_member_pointer_v<Stored> || IsStdFunction<Stored>::value) {
+            // Empty function pointers and std::function objects produce empty wrapper
+            if (!static_cast<bool>(callable)) {
+                return;
+            }
+        }
+        if constexpr (isStoredInline<Stored>) {
+            ::new (static_cast<void*>(m_storage)) Stored(std::forward<Callable>(callable));
+            m_operations = &inlineOperations<Stored>;
+        } else {
+            ::new (static_cast<void*>(m_storage)) Stored*(new Stored(std::forward<Callable>(callable)));
+            m_operations = &heapOperations<Stored>;
+        }
+    }
+    InplaceFunction(InplaceFunction&& other) noexcept : m_operations{other.m_operations} {
+        if (m_operations) {
+            m_operations->relocate(m_storage, other.m_storage);
+            other.m_operations = nullptr;
+        }
+    }
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other.m_operations) {
+                other.m_operations->relocate(m_storage, other.m_storage);
+                m_operations = std::exchange(other.m_operations, nullptr);
+            }
+        }
+        return *this;
+    }
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+    ~InplaceFunction() { reset(); }
+
+    /**
+     * @brief - Invoke wrapped callable, wrapper must not be empty
+     */
+    Result operator()(Args... args) const {
+        return m_operations->invoke(const_cast<std::byte*>(m_storage), std::forward<Args>(args)...);
+    }
+    explicit operator bool() const noexcept { return m_operations != nullptr; }
+};
+
+} // namespace Timers
@@ -1,4 +1,12 @@
 #pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#ifndef TIMERS_LOG_LEVEL
+#define TIMERS_LOG_LEVEL 3
+#endif
 
 namespace Timers {
 
@@ -6,6 +14,11 @@ class Logger {
 public:
     enum class Level { Critical, Error, Warning, Info, Debug, Trace };
 
+    /**
+     * @brief - Most verbose level of diagnostics compiled into library, selected by TIMERS_LOG_LEVEL
+     */
+    static constexpr Level COMPILED_LEVEL = static_cast<Level>(TIMERS_LOG_LEVEL);
+
     static std::string levelToString(const Level& level) {
         std::string levelAsString{};
         switch (level) {
@@ -30,10 +43,42 @@ public:
         }
         return levelAsString;
     }
+    /**
+     * @brief - Check if diagnostics of level are compiled into library
+     */
+    static constexpr bool isCompiledIn(Level level) { return level <= COMPILED_LEVEL; }
+    /**
+     * @brief - Set logger receiving diagnostics of whole library
+     * @param logger - Logger instance, nullptr drops diagnostics
+     */
+    static void setInstance(std::shared_ptr<Logger> logger);
+    /**
+     * @brief - Pass diagnostic to logger, messages of levels not compiled in cost nothing
+     * @param message - Diagnostic message
+     */
+    template <Level level>
+    static void log(std::string_view message) noexcept {
+        if constexpr (isCompiledIn(level)) {
+            write(level, message);
+        }
+    }
+
+    virtual ~Logger() = default;
+    virtual void operator()(Level level, std::string_view message) noexcept = 0;
+
 protected:
     Logger() = default;
-    ~Logger() = default;
-    virtual void operator()(Level level, std::string_view message) noexcept = 0;
+
+private:
+    /**
+     * @brief - Logger receiving diagnostics, shared by all threads of library
+     */
+    static std::atomic<std::shared_ptr<Logger>> instance;
+
+    /**
+     * @brief - Pass diagnostic to logger instance, if it is set
+     */
+    static void write(Level level, std::string_view message) noexcept;
 };
 
 } // namespace Timers
@@ -1,11 +1,17 @@
 #pragma once
 #include "Internal/TimersActionsQueue.hpp"
 #include "Internal/TimersCache.hpp"
+#include "Internal/TimersConfiguration.hpp"
+#include "Internal/TimersExecutor.hpp"
 #include "Internal/TimersImplementation.hpp"
 #include "Internal/TimersLogger.hpp"
 #include "Internal/TimersRunner.hpp"
+#include "Internal/TimersShard.hpp"
+#include "Internal/TimersStatistics.hpp"
+#include "Internal/TimersThreadSettings.hpp"
 #include <condition_variable>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <vector>
 
@@ -25,9 +31,10 @@ private:
      */
     static std::once_flag initInstanceFlag;
     /**
-     * @brief - Default constructor of TimersManager
+     * @brief - Constructor of TimersManager
+     * @param configuration - Configuration of manager
      */
-    TimersManager() = default;
+    explicit TimersManager(const TimersConfiguration& configuration);
     /**
      * @brief - Destructor of TimersManager
      */
@@ -42,25 +49,65 @@ private:
      */
     std::atomic<bool> threadsRunning{false};
     /**
-     * @brief - Timers thread controller
+     * @brief - Configuration of manager
      */
-    ThreadControl m_threadControl{};
+    TimersConfiguration configuration;
     /**
-     * @brief - Timers container
+     * @brief - Records of timers addressed by handles, shared by all shards
      */
-    TimersCache timersCache{};
+    TimersSlab slab{};
     /**
-     * @brief - All actions are processed by this module
+     * @brief - Independent timers threads, with their containers and actions queues
      */
-    ActionsQueue actionsQueue{m_threadControl, timersCache};
+    std::vector<std::unique_ptr<TimersShard>> shards{};
     /**
-     * @brief - Thread on which timers are ticking
+     * @brief - Pool executing callbacks of expired timers, nullptr if they are executed on timers threads
      */
-    std::thread timersThread{};
+    std::unique_ptr<TimersExecutor> executor{nullptr};
+    /**
+     * @brief - Pool executing callbacks of timers in lower priority lanes, nullptr if they are executed like other timers
+     */
+    std::unique_ptr<TimersExecutor> bulkExecutor{nullptr};
+    /**
+     * @brief - Thread executing callbacks of habitually slow timers, nullptr if they are executed like other timers
+     */
+    std::unique_ptr<TimersExecutor> slowLaneExecutor{nullptr};
+    /**
+     * @brief - Return executed timer to its shard
+     * @param timer - Timer executed by executor
+     * @param callbackAction - Code returned by timer's callback
+     * @param shardIndex - Index of shard which dispatched timer
+     */
+    void completeExecution(std::shared_ptr<Timer> timer, Timer::CallbackAction callbackAction, size_t shardIndex);
     /**
      * @brief - Logger instance
      */
     std::shared_ptr<Logger> logger{nullptr};
+    /**
+     * @brief - Select shard for timer which is being started
+     * @param timer - Timer to start
+     * @return - Index of shard
+     */
+    size_t selectShard(const std::shared_ptr<Timer>& timer) const;
+    /**
+     * @brief - Get shard of timer, timer is assigned to shard on first call
+     * @param timer - Timer
+     * @return - Index of shard
+     */
+    size_t shardOf(const std::shared_ptr<Timer>& timer) const;
+    /**
+     * @brief - Get shard of timer addressed by handle
+     * @param timerId - Handle of timer
+     * @return - Shard of timer
+     */
+    TimersShard& shardOf(TimerId timerId);
+    /**
+     * @brief - Queue batch action on every shard, which has timers in batch
+     * @param action - Batch action
+     * @param batches - Timers of batch, split by shard index
+     * @param callback - Function called once per involved shard
+     */
+    void pushBatches(TIMER_ACTION action, std::vector<std::vector<std::shared_ptr<Timer>>>& batches, ActionCallback callback);
 
 public:
     /**
@@ -73,8 +120,9 @@ public:
     TimersManager& operator=(const TimersManager&) = delete;
     /**
      * @brief - Initialize TimersManager Singleton
+     * @param configuration - Configuration of manager
      */
-    static void initialize();
+    static void initialize(const TimersConfiguration& configuration = {});
     /**
      * @brief - Check if Timers Manager is initialized
      */
@@ -87,8 +135,9 @@ public:
     static bool isRunning();
     /**
      * @brief - Start's timers thread
+     * @param threadsConfiguration - Affinity, scheduling, names and stacks of started timers and worker threads
      */
-    static void start();
+    static void start(const ThreadsConfiguration& threadsConfiguration = {});
     /**
      * @brief - Stop's timers thread
      */
@@ -97,14 +146,88 @@ public:
      * @brief - Register new timer
      * @param timer - timer to register
      */
-    static void addTimer(std::shared_ptr<Timer> timer, std::function<void(uint8_t retCode, bool newRunningState)> fnc);
+    static void addTimer(std::shared_ptr<Timer> timer, ActionCallback fnc);
     /**
      * @brief - Remove timer
      * @param timer - timer to erase
+     * @param callback - Function called from timers thread, after timer was removed
+     */
+    static void eraseTimer(std::shared_ptr<Timer> timer, ActionCallback callback = nullptr);
+    /**
+     * @brief - Restart timer, it expires after its duration from now. Lazily cancelled timer is started again
+     * @details - Timer which was never started is assigned to its first shard, use addTimer to start it on selected one
+     * @param timer - Timer to restart
+     * @param callback - Function called on timers thread, after timer was restarted
+     */
+    static void restartTimer(std::shared_ptr<Timer> timer, ActionCallback callback = nullptr);
+    /**
+     * @brief - Register batch of timers, with single action and single wake up of each involved timers thread
+     * @param timers - Timers to register
+     * @param callback - Function called once per involved shard, after its part of batch was registered.
+     *                   It may be called concurrently from timers threads of different shards
+     */
+    static void addTimers(std::span<const std::shared_ptr<Timer>> timers, ActionCallback callback = nullptr);
+    /**
+     * @brief - Remove batch of timers, with single action and single wake up of each involved timers thread
+     * @param timers - Timers to erase
+     */
+    static void eraseTimers(std::span<const std::shared_ptr<Timer>> timers);
+    /**
+     * @brief - Create timer addressed by handle, kept in compact record without reference counting
+     * @param callback - Function called on timer expiration, on timers thread
+     * @param context - Argument of callback
+     * @param interval - Duration of timer ticking, period of repeatable timer
+     * @param repeatable - Defines, if timer keeps ticking after expiration
+     * @return - Handle of created timer
+     */
+    static TimerId createTimer(TimerFunction callback, void* context, Clock::duration interval, bool repeatable = false);
+    /**
+     * @brief - Start timer addressed by handle, it expires after its interval from now. Started timer is restarted
+     * @param timerId - Handle of timer
+     */
+    static void startTimer(TimerId timerId);
+    /**
+     * @brief - Stop timer addressed by handle
+     * @param timerId - Handle of timer
+     */
+    static void stopTimer(TimerId timerId);
+    /**
+     * @brief - Stop and release timer addressed by handle, handle becomes stale
+     * @param timerId - Handle of timer
+     */
+    static void destroyTimer(TimerId timerId);
+    /**
+     * @brief - Get number of shards, each having its own timers thread
+     * @return - number of shards
+     */
+    static size_t getShardsCount();
+    /**
+     * @brief - Get descriptor, which becomes readable when timers thread of shard should wake up
+     * @details - Descriptor may be watched by external epoll loop, it must not be read or closed
+     * @param shardIndex - Index of shard
+     * @return - epoll descriptor, -1 if timers threads do not use TIMERFD wait backend
+     */
+    static int getWaitFd(size_t shardIndex = 0);
+    /**
+     * @brief - Get number of timers threads wake ups, which were avoided by executing timers within their slack
+     * @return - Number of saved wake ups, summed over all shards
+     */
+    static uint64_t getSavedWakeUps();
+    /**
+     * @brief - Get number of timers callbacks, which exceeded their execution budget
+     * @details - Budgets are set by Timer::setExecutionBudget, or by TimersConfiguration::executionBudget
+     * @return - Number of overruns, of all timers in process
+     */
+    static uint64_t getOverruns();
+    /**
+     * @brief - Get statistics of timers threads, without taking any of their locks
+     * @details - Statistics are collected only when enabled by TimersConfiguration::collectStatistics
+     * @return - Statistics summed over all shards
      */
-    static void eraseTimer(std::shared_ptr<Timer> timer);
+    static TimersStatisticsSnapshot getStatistics();
     /**
-     * @brief - Set logger instance
+     * @brief - Set logger instance, receiving diagnostics of whole library
+     * @details - Levels more verbose than TIMERS_LOG_LEVEL are not compiled in. AsyncLogger keeps writing off timers threads
      */
     static void setLogger(std::shared_ptr<Logger>);
 };
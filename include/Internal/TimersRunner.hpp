@@ -1,14 +1,18 @@
 #pragma once
 #include "Internal/TimersActionsQueue.hpp"
 #include "Internal/TimersCache.hpp"
+#include "Internal/TimersExecutor.hpp"
 #include "Internal/TimersImplementation.hpp"
+#include "Internal/TimersLogger.hpp"
+#include "Internal/TimersShard.hpp"
 #include "Internal/TimersThreadControl.hpp"
+#include <algorithm>
 #include <condition_variable>
 #include <future>
-#include <iostream>
 #include <mutex>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace Timers {
 
@@ -17,62 +21,212 @@ namespace Timers {
  */
 class TimersRunner {
 private:
-    static std::cv_status wait_for_expiration(ThreadControl& control, std::chrono::high_resolution_clock::time_point timePoint) {
-        std::unique_lock lock(control.lock);
-        return control.cond.wait_until(lock, timePoint);
+    /**
+     * @brief - Timers expired in current pass, reused between passes to avoid allocations
+     */
+    std::vector<std::shared_ptr<Timer>> m_expiredTimers{};
+    /**
+     * @brief - Expired timers handed over to bulk or slow lane executor, reused between passes to avoid allocations
+     */
+    std::vector<std::shared_ptr<Timer>> m_handedOverTimers{};
+    /**
+     * @brief - Pool executing callbacks of timers in lower priority lanes, nullptr if they are executed like other timers
+     */
+    TimersExecutor* m_bulkExecutor{nullptr};
+    /**
+     * @brief - Lowest priority lane, which is not handed over to bulk executor
+     */
+    size_t m_bulkLaneThreshold{};
+    /**
+     * @brief - Thread executing callbacks of habitually slow timers, nullptr if they are executed like other timers
+     */
+    TimersExecutor* m_slowLaneExecutor{nullptr};
+    /**
+     * @brief - Number of budget overruns, after which timer is executed on slow lane thread
+     */
+    uint32_t m_slowLaneOverruns{};
+    /**
+     * @brief - Index of shard driven by runner, handed over timers are returned to it
+     */
+    size_t m_shardIndex{};
+
+    /**
+     * @brief - Hand over expired timers matching predicate to executor, they come back through actions queue once executed
+     * @param timersCache - Timers container
+     * @param executor - Pool executing callbacks
+     * @param first - First expired timer, which may be handed over
+     * @param predicate - Selects timers to hand over
+     */
+    template <typename Predicate>
+    void handOver(TimersCache& timersCache, TimersExecutor& executor, std::vector<std::shared_ptr<Timer>>::iterator first,
+                  Predicate predicate) {
+        auto kept = first;
+        for (auto expiredTimer = first; expiredTimer != std::end(m_expiredTimers); ++expiredTimer) {
+            // Awaiting coroutines are never handed over to executors
+            if ((*expiredTimer)->dispatchInline || !predicate(**expiredTimer)) {
+                if (kept != expiredTimer) {
+                    *kept = std::move(*expiredTimer);
+                }
+                ++kept;
+                continue;
+            }
+            timersCache.checkOutTimer(*expiredTimer);
+            m_handedOverTimers.emplace_back(std::move(*expiredTimer));
+        }
+        m_expiredTimers.erase(kept, std::end(m_expiredTimers));
+        if (!m_handedOverTimers.empty()) {
+            executor.dispatch(m_handedOverTimers, m_shardIndex);
+            m_handedOverTimers.clear();
+        }
     }
+
     /**
-     * @brief - Execute all expired timers
+     * @brief - Execute all timers expired until specified time point
+     * @details - Expired timers are taken out of container in single pass, timers which should keep ticking
+     *            are registered again at their next expiration time point
      * @param timersCache - Timers container
-     * @param expiredTimers - List of expired timers
-     * @return - List of timers to delete from container
+     * @param executor - Pool executing callbacks, nullptr if callbacks are executed on this thread
+     * @param timePoint - Current time point
+     * @param statistics - Statistics recording firing lateness, nullptr if they are not collected
+     * @return - Number of expired timers
      */
-    static std::list<std::shared_ptr<Timer>> executeExpiredTimers(TimersCache& timersCache,
-                                                                  std::list<std::shared_ptr<Timer>> expiredTimers) {
-        std::list<std::shared_ptr<Timer>> timersToDelete{};
-        std::for_each(std::begin(expiredTimers), std::end(expiredTimers), [&](std::shared_ptr<Timer> expiredTimer) {
-            auto return_code = expiredTimer->run();
-            switch (return_code) {
-            case Timer::CallbackAction::NONE:
-                break;
-            case Timer::CallbackAction::DELETE:
-                timersToDelete.emplace_back(expiredTimer);
-                break;
-            default:
-                break;
+    size_t executeExpiredTimers(TimersCache& timersCache, TimersExecutor* executor, Clock::time_point timePoint,
+                                TimersStatistics* statistics) {
+        timersCache.extractExpiredTimers(timePoint, m_expiredTimers);
+        auto expiredCount = m_expiredTimers.size();
+        if (statistics) {
+            // Lateness is taken before callbacks run, as repeatable timers move their expiration time point
+            for (const auto& expiredTimer : m_expiredTimers) {
+                statistics->recordLateness(timePoint - expiredTimer->getExpirationTimePoint());
             }
-        });
+        }
+        if (m_slowLaneExecutor) {
+            // Timers which keep overrunning their budget would delay everything after them
+            handOver(timersCache, *m_slowLaneExecutor, std::begin(m_expiredTimers),
+                     [this](const Timer& timer) { return timer.getOverruns() >= m_slowLaneOverruns; });
+        }
+        if (m_bulkExecutor) {
+            // Lanes are drained highest first, so timers of lower lanes are at the end
+            auto bulk = std::partition_point(std::begin(m_expiredTimers), std::end(m_expiredTimers), [this](const std::shared_ptr<Timer>& timer) {
+                return TimersCache::priorityLane(timer->getPriority()) >= m_bulkLaneThreshold;
+            });
+            handOver(timersCache, *m_bulkExecutor, bulk, [](const Timer&) { return true; });
+        }
+        if (executor) {
+            // Timers executed inline, like awaiting coroutines, must not be touched once they were run
+            auto dispatched = std::stable_partition(std::begin(m_expiredTimers), std::end(m_expiredTimers),
+                                                    [](const std::shared_ptr<Timer>& timer) { return !timer->dispatchInline; });
+            for (auto inlineTimer = dispatched; inlineTimer != std::end(m_expiredTimers); ++inlineTimer) {
+                runExpiredTimer(timersCache, std::move(*inlineTimer));
+            }
+            m_expiredTimers.erase(dispatched, std::end(m_expiredTimers));
+            // Timers come back through actions queue once executed, so repeatable timer never runs concurrently with itself
+            for (const auto& expiredTimer : m_expiredTimers) {
+                timersCache.checkOutTimer(expiredTimer);
+            }
+            executor->dispatch(m_expiredTimers, m_shardIndex);
+            m_expiredTimers.clear();
+            return expiredCount;
+        }
 
-        return timersToDelete;
+        for (auto& expiredTimer : m_expiredTimers) {
+            runExpiredTimer(timersCache, std::move(expiredTimer));
+        }
+        m_expiredTimers.clear();
+        return expiredCount;
+    }
+    /**
+     * @brief - Execute expired timer on this thread, and register it again if it should keep ticking
+     * @param timersCache - Timers container
+     * @param expiredTimer - Expired timer
+     */
+    static void runExpiredTimer(TimersCache& timersCache, std::shared_ptr<Timer> expiredTimer) {
+        auto return_code = expiredTimer->fire();
+        switch (return_code) {
+        case Timer::CallbackAction::NONE:
+            timersCache.registerTimer(std::move(expiredTimer));
+            break;
+        case Timer::CallbackAction::DELETE:
+            break;
+        default:
+            break;
+        }
     }
 
 public:
+    /**
+     * @brief - Runner executing all expired timers in the same way
+     */
+    TimersRunner() = default;
+    /**
+     * @brief - Runner handing over timers of lower priority lanes and habitually slow timers to separate executors
+     * @param bulkExecutor - Pool executing callbacks of timers in lower priority lanes, nullptr if there is none
+     * @param bulkLaneThreshold - Lowest priority lane, which is not handed over to bulk executor
+     * @param slowLaneExecutor - Thread executing callbacks of habitually slow timers, nullptr if there is none
+     * @param slowLaneOverruns - Number of budget overruns, after which timer is executed on slow lane thread
+     * @param shardIndex - Index of shard driven by runner
+     */
+    TimersRunner(TimersExecutor* bulkExecutor, size_t bulkLaneThreshold, TimersExecutor* slowLaneExecutor = nullptr,
+                 uint32_t slowLaneOverruns = 0, size_t shardIndex = 0)
+        : m_bulkExecutor{bulkExecutor}, m_bulkLaneThreshold{bulkLaneThreshold}, m_slowLaneExecutor{slowLaneExecutor},
+          m_slowLaneOverruns{slowLaneOverruns}, m_shardIndex{shardIndex} {}
+    /**
+     * @brief - Execute all timers of shard expired until specified time point
+     * @param shard - Timers container and schedule of slab timers
+     * @param executor - Pool executing callbacks, nullptr if callbacks are executed on this thread
+     * @param timePoint - Current time point
+     * @return - Number of expired timers
+     */
+    size_t expire(TimersShard& shard, TimersExecutor* executor, Clock::time_point timePoint) {
+        auto* statistics = shard.statistics.get();
+        auto expiredCount = executeExpiredTimers(shard.timersCache, executor, timePoint, statistics);
+        // Slab timers are always executed on calling thread, their callbacks are plain functions
+        expiredCount += shard.slabSchedule.expire(timePoint, statistics);
+        shard.timersCache.compact(timePoint);
+        if (statistics) {
+            statistics->recordCallbacks(expiredCount);
+            statistics->recordCacheSize(shard.size());
+        }
+        return expiredCount;
+    }
+    /**
+     * @brief - Apply all queued actions of shard
+     * @param shard - Timers container and actions queue
+     * @return - Number of processed actions
+     */
+    static size_t process(TimersShard& shard) {
+        auto processed = shard.actionsQueue.process();
+        if (shard.statistics && processed > 0) {
+            shard.statistics->recordActions(processed);
+            shard.statistics->recordCacheSize(shard.size());
+        }
+        return processed;
+    }
     /**
      * @brief - Functionality responsible for taking timers actions
      * @param running - Control over running of timers thread
-     * @param timersCache - Timers container
-     * @param control - Timers thread-container synchronization
+     * @param shard - Timers thread's container, actions queue and synchronization
+     * @param executor - Pool executing callbacks, nullptr if callbacks are executed on timers thread
      */
-    void operator()(std::atomic<bool>& running, TimersCache& timersCache, ThreadControl& control, ActionsQueue& actionsQueue) {
+    void operator()(std::atomic<bool>& running, TimersShard& shard, TimersExecutor* executor) {
+        auto& control = shard.threadControl;
+        auto& actionsQueue = shard.actionsQueue;
+        auto hasWork = [&]() { return !running || actionsQueue.hasPendingActions(); };
         while (running) {
-            actionsQueue.process();
+            process(shard);
 
-            std::cout << "RUNNING" << std::endl;
-            auto nextExpirationTimePoint = timersCache.getNextExpirationTimePoint();
-            if (nextExpirationTimePoint.has_value()) {
-                if (wait_for_expiration(control, *nextExpirationTimePoint) == std::cv_status::timeout) {
-                    std::list<std::shared_ptr<Timer>> expiredTimers = timersCache.getTimersExpiringAt(*nextExpirationTimePoint);
-                    if (!expiredTimers.empty()) {
-                        std::list<std::shared_ptr<Timer>> timersToDelete = executeExpiredTimers(timersCache, expiredTimers);
-
-                        std::for_each(std::begin(timersToDelete), std::end(timersToDelete),
-                                      [&](std::shared_ptr<Timer> timerToDelete) { timersCache.deleteTimer(std::move(timerToDelete)); });
-                    }
-                }
-            } else {
-                // There are no timers ticking, just wait for new timers
-                std::unique_lock lock(control.lock);
-                control.cond.wait(lock);
+            Logger::log<Logger::Level::Trace>("Timers thread running");
+            auto wakeUps = control.getWakeUps();
+            size_t expiredCount{};
+            // Without timers ticking, thread just waits for new actions
+            if (control.waitUntil(shard.getNextExpirationTimePoint(), hasWork)) {
+                expiredCount = expire(shard, executor, Clock::now());
+            }
+            if (shard.statistics) {
+                // Only last return from wait may have found work, the ones before it were spurious
+                auto newWakeUps = control.getWakeUps() - wakeUps;
+                uint64_t productive = newWakeUps > 0 && (expiredCount > 0 || hasWork()) ? 1 : 0;
+                shard.statistics->recordWakeUps(productive, newWakeUps - productive);
             }
         }
     }
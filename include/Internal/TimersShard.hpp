@@ -0,0 +1,98 @@
+#pragma once
+#include "Internal/TimersActionsQueue.hpp"
+#include "Internal/TimersCache.hpp"
+#include "Internal/TimersSlab.hpp"
+#include "Internal/TimersStatistics.hpp"
+#include "Internal/TimersThreadControl.hpp"
+#include <thread>
+
+namespace Timers {
+
+/**
+ * @brief - Independent part of TimersManager, with its own timers thread, container and actions queue
+ */
+struct TimersShard {
+    /**
+     * @brief - Timers thread controller
+     */
+    ThreadControl threadControl;
+    /**
+     * @brief - Timers container
+     */
+    TimersCache timersCache;
+    /**
+     * @brief - Armed slab timers of this shard
+     */
+    SlabSchedule slabSchedule;
+    /**
+     * @brief - All actions on timers of this shard are processed by this module
+     */
+    ActionsQueue actionsQueue;
+    /**
+     * @brief - Thread on which timers of this shard are ticking
+     */
+    std::thread timersThread{};
+    /**
+     * @brief - Statistics written by timers thread of this shard, nullptr if they are not collected
+     */
+    std::unique_ptr<TimersStatistics> statistics{};
+
+    /**
+     * @brief - Shard constructor
+     * @param cacheBackend - Data structure in which shard keeps registered timers
+     * @param actionsQueueCapacity - Number of pre-allocated actions queue nodes
+     * @param slab - Slab keeping records of timers addressed by handles
+     * @param waitBackend - Mechanism on which timers thread sleeps
+     * @param waitMode - Precision with which timers thread hits expiration time points
+     * @param spinGuard - Interval before expiration time point, spent spinning in SPIN wait mode
+     * @param memoryResource - Upstream of timers container's pool, and resource of actions above queue capacity
+     */
+    TimersShard(CacheBackend cacheBackend, size_t actionsQueueCapacity, TimersSlab& slab, WaitBackend waitBackend,
+                WaitMode waitMode = WaitMode::SLEEP, Clock::duration spinGuard = {},
+                std::pmr::memory_resource* memoryResource = std::pmr::new_delete_resource())
+        : threadControl{waitBackend, waitMode, spinGuard}, timersCache{cacheBackend, memoryResource}, slabSchedule{slab},
+          actionsQueue{threadControl, timersCache, actionsQueueCapacity, &slabSchedule, memoryResource} {}
+    /**
+     * @brief - Queue action on timer, and wake up timers thread if it may be sleeping
+     */
+    void push(TIMER_ACTION action, std::shared_ptr<Timer> timer, ActionCallback callback) {
+        // Timers thread is woken up only by action pushed to empty queue, following ones are taken in the same batch
+        if (actionsQueue.push(action, std::move(timer), std::move(callback))) {
+            threadControl.notify();
+        }
+    }
+    /**
+     * @brief - Queue action on batch of timers, and wake up timers thread if it may be sleeping
+     */
+    void push(TIMER_ACTION action, std::vector<std::shared_ptr<Timer>> timers, ActionCallback callback) {
+        if (actionsQueue.push(action, std::move(timers), std::move(callback))) {
+            threadControl.notify();
+        }
+    }
+    /**
+     * @brief - Queue action on slab timer, and wake up timers thread if it may be sleeping
+     */
+    void push(TIMER_ACTION action, TimerId timerId, Clock::time_point timePoint) {
+        if (actionsQueue.push(action, timerId, timePoint)) {
+            threadControl.notify();
+        }
+    }
+    /**
+     * @brief - Get number of timers registered in this shard, must be called only from timers thread
+     */
+    [[nodiscard]] size_t size() const { return timersCache.size() + slabSchedule.size(); }
+    /**
+     * @brief - Get closest expiration time point of all timers of this shard
+     */
+    std::optional<Clock::time_point> getNextExpirationTimePoint() {
+        auto nextExpirationTimePoint = timersCache.getNextExpirationTimePoint();
+        auto nextSlabExpirationTimePoint = slabSchedule.nextExpirationTimePoint();
+        if (!nextExpirationTimePoint.has_value() ||
+            (nextSlabExpirationTimePoint.has_value() && *nextSlabExpirationTimePoint < *nextExpirationTimePoint)) {
+            nextExpirationTimePoint = nextSlabExpirationTimePoint;
+        }
+        return nextExpirationTimePoint;
+    }
+};
+
+} // namespace Timers
@@ -0,0 +1,181 @@
+#pragma once
+#include "Internal/TimersClock.hpp"
+#include "Internal/TimersIndexedHeap.hpp"
+#include "Internal/TimersStatistics.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace Timers {
+
+/**
+ * @brief - Handle of timer kept in TimersSlab, index of record in lower half and its generation in upper half
+ * @details - Generation changes whenever record is created or destroyed, so stale handles are detected cheaply
+ */
+class TimerId {
+private:
+    uint64_t m_value{};
+
+public:
+    constexpr TimerId() = default;
+    constexpr TimerId(uint32_t index, uint32_t generation) : m_value{static_cast<uint64_t>(generation) << 32 | index} {}
+    [[nodiscard]] constexpr uint32_t index() const { return static_cast<uint32_t>(m_value); }
+    [[nodiscard]] constexpr uint32_t generation() const { return static_cast<uint32_t>(m_value >> 32); }
+    [[nodiscard]] constexpr uint64_t value() const { return m_value; }
+    /**
+     * @brief - Check if handle may refer to timer, default constructed handle never does
+     */
+    [[nodiscard]] constexpr bool isValid() const { return (generation() & 1) != 0; }
+    constexpr bool operator==(const TimerId&) const = default;
+};
+
+/**
+ * @brief - Callback of timer kept in TimersSlab
+ */
+using TimerFunction = void (*)(void* context);
+
+/**
+ * @brief - Compact timer record kept in TimersSlab
+ */
+struct TimerRecord {
+    static constexpr uint32_t NO_LINK = UINT32_MAX;
+
+    /**
+     * @brief - Duration of timer ticking, period of repeatable timer
+     */
+    Clock::duration interval{};
+    TimerFunction callback{nullptr};
+    void* context{nullptr};
+    /**
+     * @brief - Odd while record is in use, even while it is free
+     */
+    std::atomic<uint32_t> generation{};
+    /**
+     * @brief - Index in SlabSchedule heap while timer is armed, index of next free record while record is free
+     */
+    uint32_t link{NO_LINK};
+    bool repeatable{false};
+};
+
+/**
+ * @brief - Slab of fixed-size timer records, addressed by TimerId handles
+ * @details - Records are allocated in chunks which are never moved or released before slab is destroyed,
+ *            so record may be accessed from timers threads while other records are created
+ */
+class TimersSlab {
+public:
+    static constexpr size_t CHUNK_SIZE = 4096;
+    static constexpr size_t MAX_CHUNKS = 16384;
+
+private:
+    /**
+     * @brief - Guards creation and destruction of records
+     */
+    std::mutex m_mutex;
+    std::unique_ptr<std::atomic<TimerRecord*>[]> m_chunks;
+    /**
+     * @brief - Number of allocated chunks
+     */
+    size_t m_chunksCount{};
+    /**
+     * @brief - Index of first never used record
+     */
+    uint32_t m_nextUnused{};
+    /**
+     * @brief - Index of first free record, TimerRecord::NO_LINK if there is none
+     */
+    uint32_t m_freeList{TimerRecord::NO_LINK};
+    /**
+     * @brief - Number of records in use
+     */
+    size_t m_size{};
+
+public:
+    TimersSlab();
+    ~TimersSlab();
+    TimersSlab(const TimersSlab&) = delete;
+    TimersSlab& operator=(const TimersSlab&) = delete;
+    /**
+     * @brief - Create timer record
+     * @param callback - Function called on timer expiration
+     * @param context - Argument of callback
+     * @param interval - Duration of timer ticking, period of repeatable timer
+     * @param repeatable - Defines, if timer keeps ticking after expiration
+     * @return - Handle of created timer
+     */
+    TimerId create(TimerFunction callback, void* context, Clock::duration interval, bool repeatable);
+    /**
+     * @brief - Release timer record, record must not be armed
+     * @return - false if handle was stale
+     */
+    bool destroy(TimerId timerId);
+    /**
+     * @brief - Get record referred by handle
+     * @return - Record, nullptr if handle is stale
+     */
+    [[nodiscard]] TimerRecord* find(TimerId timerId) const;
+    /**
+     * @brief - Get record at index, index must refer to created record
+     */
+    [[nodiscard]] TimerRecord& at(uint32_t index) const;
+    /**
+     * @brief - Get number of records in use
+     */
+    [[nodiscard]] size_t size();
+};
+
+/**
+ * @brief - Schedule of armed slab timers, used only from single timers thread
+ */
+class SlabSchedule {
+private:
+    struct Entry {
+        Clock::time_point expirationTimePoint;
+        uint32_t index;
+    };
+    struct EntryPosition {
+        TimersSlab* slab;
+        void operator()(Entry& entry, size_t index) const { slab->at(entry.index).link = static_cast<uint32_t>(index); }
+    };
+
+    TimersSlab& m_slab;
+    IndexedHeap<Entry, EntryPosition> m_heap;
+
+public:
+    explicit SlabSchedule(TimersSlab& slab);
+    /**
+     * @brief - Arm timer to expire at time point, armed timer is moved
+     * @return - false if handle was stale
+     */
+    bool arm(TimerId timerId, Clock::time_point expirationTimePoint);
+    /**
+     * @brief - Disarm timer
+     * @return - false if handle was stale or timer was not armed
+     */
+    bool disarm(TimerId timerId);
+    /**
+     * @brief - Disarm timer and release its record
+     * @return - false if handle was stale
+     */
+    bool destroy(TimerId timerId);
+    /**
+     * @brief - Get number of armed timers
+     */
+    [[nodiscard]] size_t size() const;
+    /**
+     * @brief - Get closest expiration time point of armed timers
+     */
+    [[nodiscard]] std::optional<Clock::time_point> nextExpirationTimePoint() const;
+    /**
+     * @brief - Execute callbacks of all timers expired until time point, repeatable timers are armed for next period
+     * @param timePoint - Current time point
+     * @param statistics - Statistics recording firing lateness, nullptr if they are not collected
+     * @return - Number of executed callbacks
+     */
+    size_t expire(Clock::time_point timePoint, TimersStatistics* statistics = nullptr);
+};
+
+} // namespace Timers
@@ -0,0 +1,176 @@
+#pragma once
+#include "Internal/TimersClock.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Timers {
+
+/**
+ * @brief - Histogram of timers firing lateness, with logarithmic buckets of bounded relative error
+ * @details - Values below SUB_BUCKETS nanoseconds have exact buckets, every following power of two is split into
+ *            SUB_BUCKETS linear buckets, so recorded value is known with relative error below 1 / SUB_BUCKETS.
+ *            Counts are written only by owning timers thread, and may be read by any thread.
+ */
+class LatenessHistogram {
+public:
+    static constexpr size_t SUB_BUCKET_BITS = 4;
+    static constexpr size_t SUB_BUCKETS = size_t{1} << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKETS = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    /**
+     * @brief - Get bucket counting value
+     * @param nanoseconds - Recorded value
+     * @return - Index of bucket
+     */
+    static size_t bucketOf(uint64_t nanoseconds) noexcept;
+    /**
+     * @brief - Get smallest value counted by bucket
+     * @param bucket - Index of bucket
+     * @return - Lower bound of bucket, in nanoseconds
+     */
+    static uint64_t lowerBoundOf(size_t bucket) noexcept;
+    /**
+     * @brief - Count lateness, timers fired before their deadline are counted as not late
+     * @param lateness - Time between deadline and firing of timer
+     */
+    void record(Clock::duration lateness) noexcept {
+        auto nanoseconds = lateness.count() > 0 ? static_cast<uint64_t>(lateness.count()) : uint64_t{0};
+        auto& count = m_counts[bucketOf(nanoseconds)];
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (nanoseconds > m_max.load(std::memory_order_relaxed)) {
+            m_max.store(nanoseconds, std::memory_order_relaxed);
+        }
+    }
+    /**
+     * @brief - Add counts of histogram to output vector, which is resized to BUCKETS
+     * @param counts - Output vector
+     * @return - Largest recorded value, in nanoseconds
+     */
+    uint64_t collect(std::vector<uint64_t>& counts) const;
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS> m_counts{};
+    std::atomic<uint64_t> m_max{};
+};
+
+/**
+ * @brief - Statistics of timers threads, copied out of live counters
+ */
+struct TimersStatisticsSnapshot {
+    /**
+     * @brief - Wake ups of timers thread, after which timers were executed or actions were waiting
+     */
+    uint64_t productiveWakeUps{};
+    /**
+     * @brief - Wake ups of timers thread, after which there was nothing to do
+     */
+    uint64_t spuriousWakeUps{};
+    /**
+     * @brief - Number of executed timers callbacks, dispatched ones are counted when they are handed to executor
+     */
+    uint64_t callbacksExecuted{};
+    /**
+     * @brief - Number of processed actions
+     */
+    uint64_t actionsProcessed{};
+    /**
+     * @brief - Largest number of actions processed in single batch, maximum over shards
+     */
+    uint64_t actionsQueueHighWater{};
+    /**
+     * @brief - Number of registered timers after last pass of timers threads
+     */
+    uint64_t cacheSize{};
+    /**
+     * @brief - Counts of firing lateness, indexed by LatenessHistogram bucket
+     */
+    std::vector<uint64_t> latenessCounts{};
+    /**
+     * @brief - Largest firing lateness
+     */
+    Clock::duration latenessMax{};
+
+    /**
+     * @brief - Get number of timers, of which firing lateness was recorded
+     */
+    [[nodiscard]] uint64_t latenessSamples() const;
+    /**
+     * @brief - Get firing lateness, which is not exceeded by fraction of timers
+     * @param fraction - Fraction of timers, from 0.0 to 1.0
+     * @return - Lower bound of bucket containing requested lateness, zero if nothing was recorded
+     */
+    [[nodiscard]] Clock::duration latenessPercentile(double fraction) const;
+    /**
+     * @brief - Add statistics of another shard
+     * @param other - Statistics to add
+     */
+    void merge(const TimersStatisticsSnapshot& other);
+};
+
+/**
+ * @brief - Live statistics of single timers thread
+ * @details - Counters are written only by timers thread owning them, so they are updated without atomic
+ *            read-modify-write and without locks. Snapshot may be taken from any thread at any time.
+ */
+class TimersStatistics {
+private:
+    LatenessHistogram m_lateness{};
+    std::atomic<uint64_t> m_productiveWakeUps{};
+    std::atomic<uint64_t> m_spuriousWakeUps{};
+    std::atomic<uint64_t> m_callbacksExecuted{};
+    std::atomic<uint64_t> m_actionsProcessed{};
+    std::atomic<uint64_t> m_actionsQueueHighWater{};
+    std::atomic<uint64_t> m_cacheSize{};
+
+    /**
+     * @brief - Increase counter written only by calling thread
+     */
+    static void add(std::atomic<uint64_t>& counter, uint64_t value) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+public:
+    /**
+     * @brief - Record firing lateness of timer
+     * @param lateness - Time between deadline and firing of timer
+     */
+    void recordLateness(Clock::duration lateness) noexcept { m_lateness.record(lateness); }
+    /**
+     * @brief - Record wake ups of timers thread
+     * @param productive - Wake ups after which there was work
+     * @param spurious - Wake ups after which there was nothing to do
+     */
+    void recordWakeUps(uint64_t productive, uint64_t spurious) noexcept {
+        add(m_productiveWakeUps, productive);
+        add(m_spuriousWakeUps, spurious);
+    }
+    /**
+     * @brief - Record executed timers callbacks
+     * @param executed - Number of callbacks
+     */
+    void recordCallbacks(size_t executed) noexcept { add(m_callbacksExecuted, executed); }
+    /**
+     * @brief - Record batch of processed actions
+     * @param processed - Number of actions in batch
+     */
+    void recordActions(size_t processed) noexcept {
+        add(m_actionsProcessed, processed);
+        if (processed > m_actionsQueueHighWater.load(std::memory_order_relaxed)) {
+            m_actionsQueueHighWater.store(processed, std::memory_order_relaxed);
+        }
+    }
+    /**
+     * @brief - Record number of registered timers
+     * @param size - Number of timers
+     */
+    void recordCacheSize(size_t size) noexcept { m_cacheSize.store(size, std::memory_order_relaxed); }
+    /**
+     * @brief - Copy current values of counters
+     */
+    [[nodiscard]] TimersStatisticsSnapshot snapshot() const;
+};
+
+} // namespace Timers
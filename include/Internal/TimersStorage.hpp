@@ -0,0 +1,122 @@
+#pragma once
+#include "Internal/TimersImplementation.hpp"
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Timers {
+
+/**
+ * @brief - Interface of container in which TimersCache keeps registered timers
+ * @details - Timers are ordered by their latest expiration time point, which includes timer's slack
+ */
+class TimersStorage {
+protected:
+    /**
+     * @brief - Access position of timer inside of storage
+     * @param timer - Timer which position is requested
+     * @return - Reference to timer's storage position
+     */
+    static Timer::CachePosition& positionOf(Timer& timer) { return timer.cachePosition; }
+
+public:
+    virtual ~TimersStorage() = default;
+    /**
+     * @brief - Add timer to storage, timer must not be registered yet
+     * @param timer - Timer to add
+     */
+    virtual void insert(std::shared_ptr<Timer> timer) = 0;
+    /**
+     * @brief - Add batch of timers to storage, timers which are already stored are skipped
+     * @param timers - Timers to add
+     * @return - Number of added timers
+     */
+    virtual size_t insertBatch(std::span<const std::shared_ptr<Timer>> timers) {
+        size_t inserted{};
+        for (const auto& timer : timers) {
+            if (!contains(timer)) {
+                insert(timer);
+                ++inserted;
+            }
+        }
+        return inserted;
+    }
+    /**
+     * @brief - Remove timer from storage
+     * @param timer - Timer to remove
+     * @return - true if timer was removed, false if it was not registered
+     */
+    virtual bool erase(const std::shared_ptr<Timer>& timer) = 0;
+    /**
+     * @brief - Remove all timers matching predicate
+     * @param predicate - Predicate selecting timers to remove, it may release timers which it selects
+     * @return - Number of removed timers
+     */
+    virtual size_t eraseIf(bool (*predicate)(Timer&)) = 0;
+    /**
+     * @brief - Check if timer is stored
+     * @param timer - Timer to check
+     * @return - true if timer is stored, false otherwise
+     */
+    [[nodiscard]] virtual bool contains(const std::shared_ptr<Timer>& timer) const = 0;
+    /**
+     * @brief - Get number of stored timers
+     * @return - number of timers
+     */
+    [[nodiscard]] virtual size_t size() const = 0;
+    /**
+     * @brief - Get closest expiration time point of stored timers
+     * @return - Closest expiration time point, std::nullopt if storage is empty
+     */
+    [[nodiscard]] virtual std::optional<Clock::time_point> nextExpirationTimePoint() = 0;
+    /**
+     * @brief - Append all timers expiring exactly at specified time point
+     * @param timePoint - Time point
+     * @param expiredTimers - Output list
+     */
+    virtual void collectExpiringAt(Clock::time_point timePoint, std::pmr::list<std::shared_ptr<Timer>>& expiredTimers) = 0;
+    /**
+     * @brief - Remove all timers expiring not later than specified time point, appending them to output vector
+     * @param timePoint - Time point
+     * @param expiredTimers - Output vector
+     */
+    virtual void extractExpired(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) = 0;
+};
+
+/**
+ * @brief - Storage in which timers are kept in multimap, ordered by expiration time point
+ */
+class MultimapStorage : public TimersStorage {
+private:
+    /**
+     * @brief Multimap in which expiration time point is key
+     */
+    std::pmr::multimap<Clock::time_point, std::shared_ptr<Timer>> m_timers;
+    /**
+     * @brief - Timers of inserted batch with their keys, reused between batches to avoid allocations
+     */
+    std::pmr::vector<std::pair<Clock::time_point, std::shared_ptr<Timer>>> m_batch;
+
+public:
+    /**
+     * @brief - Multimap storage constructor
+     * @param resource - Memory resource from which multimap nodes are allocated
+     */
+    explicit MultimapStorage(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    void insert(std::shared_ptr<Timer> timer) override;
+    size_t insertBatch(std::span<const std::shared_ptr<Timer>> timers) override;
+    bool erase(const std::shared_ptr<Timer>& timer) override;
+    size_t eraseIf(bool (*predicate)(Timer&)) override;
+    [[nodiscard]] bool contains(const std::shared_ptr<Timer>& timer) const override;
+    [[nodiscard]] size_t size() const override;
+    [[nodiscard]] std::optional<Clock::time_point> nextExpirationTimePoint() override;
+    void collectExpiringAt(Clock::time_point timePoint, std::pmr::list<std::shared_ptr<Timer>>& expiredTimers) override;
+    void extractExpired(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) override;
+};
+
+} // namespace Timers
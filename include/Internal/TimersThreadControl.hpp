@@ -1,15 +1,212 @@
 #pragma once
-#include <mutex>
+#include "Internal/TimersClock.hpp"
+#include <chrono>
+#include <algorithm>
 #include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
 
 namespace Timers {
 
+/**
+ * @brief - Defines, how timers thread sleeps until next expiration or new action
+ * @details - CONDITION_VARIABLE ( Portable std::condition_variable wait, notification takes mutex )
+ * @details - TIMERFD ( Linux epoll wait on timerfd armed with absolute time and eventfd signalled on new actions,
+ *                      falls back to CONDITION_VARIABLE on other systems )
+ */
+enum WaitBackend { CONDITION_VARIABLE, TIMERFD };
+
+/**
+ * @brief - Defines, how precisely timers thread hits expiration time point
+ * @details - SLEEP ( Sleep until expiration time point, wake up is delayed by scheduler )
+ * @details - SPIN ( Sleep until guard interval before expiration time point, then spin until it )
+ * @details - BUSY_POLL ( Never sleep, keep polling clock and actions queue, intended for dedicated isolated core )
+ */
+enum WaitMode { SLEEP, SPIN, BUSY_POLL };
+
+/**
+ * @brief - Hint processor, that thread is spinning
+ */
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
 /**
  * @brief - Timers thread controll
  */
 struct ThreadControl {
     std::mutex lock;
     std::condition_variable cond;
+
+private:
+    /**
+     * @brief - Descriptors used by TIMERFD backend, -1 when condition variable is used
+     */
+    int m_epollFd{-1};
+    int m_timerFd{-1};
+    int m_eventFd{-1};
+    /**
+     * @brief - Steady time point to which timer descriptor is armed
+     */
+    std::optional<std::chrono::steady_clock::time_point> m_armedTimePoint{};
+    WaitMode m_waitMode{WaitMode::SLEEP};
+    /**
+     * @brief - Interval before expiration time point, spent spinning in SPIN mode
+     */
+    Clock::duration m_spinGuard{};
+    /**
+     * @brief - Number of returns from blocking wait, counted on timers thread
+     */
+    uint64_t m_wakeUps{};
+
+    /**
+     * @brief - Arm timer descriptor to expire at steady time point, or disarm it
+     * @param timePoint - Expiration time point, std::nullopt disarms timer descriptor
+     * @return - true if timer descriptor was armed, false if failure was reported
+     */
+    bool armTimer(std::optional<std::chrono::steady_clock::time_point> timePoint) noexcept;
+    /**
+     * @brief - Sleep until timer descriptor expires or notification is sent, and consume both
+     * @param timeout - Longest sleep, std::nullopt waits for descriptors only
+     */
+    void sleep(std::optional<std::chrono::steady_clock::time_point> timeout = std::nullopt);
+    /**
+     * @brief - Close descriptors of TIMERFD backend
+     */
+    void closeDescriptors();
+    /**
+     * @brief - Sleep until time point, or until there is work for timers thread
+     * @return - true if time point was reached, false if there is work
+     */
+    template <typename Predicate>
+    bool sleepUntil(std::optional<Clock::time_point> timePoint, Predicate& hasWork) {
+        while (!hasWork()) {
+            if (timePoint.has_value() && !(Clock::now() < *timePoint)) {
+                return true;
+            }
+            std::optional<std::chrono::steady_clock::time_point> wakeUpTimePoint{};
+            if (timePoint.has_value()) {
+                wakeUpTimePoint = toSteadyTimePoint(*timePoint);
+            }
+            if (m_epollFd < 0) {
+                std::unique_lock lockGuard(lock);
+                if (wakeUpTimePoint.has_value()) {
+                    cond.wait_until(lockGuard, *wakeUpTimePoint, hasWork);
+                } else {
+                    cond.wait(lockGuard, hasWork);
+                }
+            } else if (armTimer(wakeUpTimePoint)) {
+                sleep();
+            } else {
+                // Event descriptor still wakes thread up, while expiration is reached by timeout of wait
+                sleep(wakeUpTimePoint);
+            }
+            ++m_wakeUps;
+        }
+        return false;
+    }
+    /**
+     * @brief - Get steady time point, at which timers thread should wake up to reach time point of Clock
+     * @details - Virtual clock is advanced by other threads without notifying timers threads, so its
+     *            time points are reached by waking up at least every VIRTUAL_CLOCK_POLL_INTERVAL
+     */
+    static std::chrono::steady_clock::time_point toSteadyTimePoint(Clock::time_point timePoint) {
+        using SteadyDuration = std::chrono::steady_clock::duration;
+        if (Clock::getSource() == ClockSource::VIRTUAL) {
+            auto remaining = std::min<Clock::duration>(timePoint - Clock::now(), VIRTUAL_CLOCK_POLL_INTERVAL);
+            return std::chrono::steady_clock::now() + std::chrono::duration_cast<SteadyDuration>(remaining);
+        }
+        // Steady and coarse clocks share epoch of steady clock, coarse clock reaches time point up to its resolution later
+        auto sinceEpoch = timePoint.time_since_epoch() + Clock::getResolution();
+        return std::chrono::steady_clock::time_point{std::chrono::duration_cast<SteadyDuration>(sinceEpoch)};
+    }
+    /**
+     * @brief - Spin until time point, or until there is work for timers thread
+     * @return - true if time point was reached, false if there is work
+     */
+    template <typename Predicate>
+    static bool spinUntil(std::optional<Clock::time_point> timePoint, Predicate& hasWork) {
+        while (!hasWork()) {
+            if (timePoint.has_value() && !(Clock::now() < *timePoint)) {
+                return true;
+            }
+            cpuRelax();
+        }
+        return false;
+    }
+
+public:
+    /**
+     * @brief - Longest real time sleep of timers thread, while virtual clock is used
+     */
+    static constexpr std::chrono::milliseconds VIRTUAL_CLOCK_POLL_INTERVAL{1};
+    /**
+     * @brief - Create thread control waiting on condition variable
+     */
+    ThreadControl() = default;
+    /**
+     * @brief - Create thread control waiting with specified backend
+     * @param waitBackend - Mechanism on which timers thread sleeps
+     */
+    explicit ThreadControl(WaitBackend waitBackend);
+    /**
+     * @brief - Create thread control waiting with specified backend and precision
+     * @param waitBackend - Mechanism on which timers thread sleeps
+     * @param waitMode - Precision of hitting expiration time point
+     * @param spinGuard - Interval before expiration time point, spent spinning in SPIN mode
+     */
+    ThreadControl(WaitBackend waitBackend, WaitMode waitMode, Clock::duration spinGuard);
+    ~ThreadControl();
+    ThreadControl(const ThreadControl&) = delete;
+    ThreadControl& operator=(const ThreadControl&) = delete;
+
+    /**
+     * @brief - Wake up timers thread
+     * @details - With condition variable lock is taken, so wake up can not be lost between timers thread checking
+     *            for work and going to sleep. Eventfd keeps its counter until it is read, so no lock is needed.
+     */
+    void notify();
+    /**
+     * @brief - Sleep until time point, or until there is work for timers thread
+     * @param timePoint - Wake up time point, std::nullopt to wait only for work
+     * @param hasWork - Predicate checked before every sleep
+     * @return - true if time point was reached, false if there is work
+     */
+    template <typename Predicate>
+    bool waitUntil(std::optional<Clock::time_point> timePoint, Predicate hasWork) {
+        switch (m_waitMode) {
+        case WaitMode::BUSY_POLL:
+            return spinUntil(timePoint, hasWork);
+        case WaitMode::SPIN:
+            if (timePoint.has_value()) {
+                // Scheduler wake up is late by tens of microseconds, so thread wakes up before expiration and spins
+                auto wakeUpTimePoint = *timePoint - m_spinGuard;
+                if (Clock::now() < wakeUpTimePoint && !sleepUntil(wakeUpTimePoint, hasWork)) {
+                    return false;
+                }
+                return spinUntil(timePoint, hasWork);
+            }
+            return sleepUntil(timePoint, hasWork);
+        case WaitMode::SLEEP:
+        default:
+            return sleepUntil(timePoint, hasWork);
+        }
+    }
+    /**
+     * @brief - Get descriptor, which becomes readable when timers thread should wake up
+     * @details - Descriptor may be added to external epoll loop, it is -1 when condition variable is used
+     * @return - epoll descriptor watching timer descriptor and notifications
+     */
+    [[nodiscard]] int fd() const { return m_epollFd; }
+    /**
+     * @brief - Get number of returns from blocking wait, spinning is not counted. Must be called only from timers thread
+     */
+    [[nodiscard]] uint64_t getWakeUps() const { return m_wakeUps; }
 };
 
-}
\ No newline at end of file
+} // namespace Timers
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Timers {
+
+/**
+ * @brief - Scheduling policy of threads started by library
+ * @details - OTHER ( Default time-sharing policy, inherited priority is kept )
+ * @details - FIFO ( Real-time SCHED_FIFO, thread runs until it blocks or is preempted by higher priority )
+ * @details - ROUND_ROBIN ( Real-time SCHED_RR, threads of equal priority share processor in time slices )
+ */
+enum SchedulingPolicy { OTHER, FIFO, ROUND_ROBIN };
+
+/**
+ * @brief - Settings applied by thread started by library, before it enters its loop
+ * @details - Settings are supported on Linux only, elsewhere they are ignored. Setting which cannot be applied,
+ *            for example real-time policy without required privileges, is reported through Logger and skipped
+ */
+struct ThreadSettings {
+    /**
+     * @brief - Processors on which thread may run, empty keeps inherited affinity
+     */
+    std::vector<size_t> cpus{};
+    /**
+     * @brief - Scheduling policy of thread
+     */
+    SchedulingPolicy schedulingPolicy{SchedulingPolicy::OTHER};
+    /**
+     * @brief - Priority of real-time scheduling policy, ignored for OTHER policy
+     */
+    int priority{0};
+    /**
+     * @brief - Name of thread, followed by its index. Empty keeps inherited name, longer names are truncated
+     */
+    std::string name{};
+    /**
+     * @brief - Number of bytes of stack touched before thread enters its loop, so it does not page fault later.
+     *          Number exceeding free stack of thread is reported and skipped
+     */
+    size_t stackPrefault{0};
+    /**
+     * @brief - Defines, if pre-faulted part of stack is locked in memory, so it is never paged out
+     */
+    bool lockStack{false};
+};
+
+/**
+ * @brief - Settings of all threads started by TimersManager::start
+ */
+struct ThreadsConfiguration {
+    /**
+     * @brief - Timers threads of shards, taking actions and keeping time
+     */
+    ThreadSettings runner{.name = "timers"};
+    /**
+     * @brief - Worker threads executing callbacks, in EXECUTOR dispatch mode
+     */
+    ThreadSettings executor{.name = "timers-exec"};
+    /**
+     * @brief - Worker threads executing callbacks of timers in lower priority lanes
+     */
+    ThreadSettings bulkExecutor{.name = "timers-bulk"};
+    /**
+     * @brief - Thread executing callbacks of habitually slow timers
+     */
+    ThreadSettings slowLaneExecutor{.name = "timers-slow"};
+};
+
+/**
+ * @brief - Apply settings to calling thread
+ * @param settings - Settings to apply
+ * @param index - Index of thread among threads sharing settings, appended to its name
+ * @return - true if all settings were applied, false if any of them was skipped
+ */
+bool applyThreadSettings(const ThreadSettings& settings, size_t index);
+
+} // namespace Timers
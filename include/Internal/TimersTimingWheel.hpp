@@ -0,0 +1,126 @@
+#pragma once
+#include "Internal/TimersStorage.hpp"
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace Timers {
+
+/**
+ * @brief - Hierarchical timing wheel storage
+ * @details - Timers are hashed into one of LEVELS wheels, each having SLOTS_PER_LEVEL slots. Slot of level N covers
+ *            SLOTS_PER_LEVEL^N ticks, timers which do not fit into highest level are kept in overflow slot.
+ *            Registration and removal are O(1), timers are cascaded to lower levels when wheel cursor reaches their slot.
+ *            Cursor follows current time point passed to extractExpired, it is never moved to future expiration time point,
+ *            so timers registered later with shorter durations are still spread over slots.
+ */
+class TimingWheel : public TimersStorage {
+public:
+    static constexpr size_t SLOT_BITS = 8;
+    static constexpr size_t SLOTS_PER_LEVEL = 1 << SLOT_BITS;
+    static constexpr size_t LEVELS = 4;
+    static constexpr Clock::duration DEFAULT_RESOLUTION = std::chrono::milliseconds(1);
+
+private:
+    static constexpr size_t OVERFLOW_SLOT = LEVELS * SLOTS_PER_LEVEL;
+    static constexpr size_t WORD_BITS = 64;
+    static constexpr size_t WORDS_PER_LEVEL = SLOTS_PER_LEVEL / WORD_BITS;
+
+    /**
+     * @brief - Duration of single tick of lowest level
+     */
+    Clock::duration m_resolution;
+    /**
+     * @brief - Tick of latest current time point, timers already expired at registration are kept in its slot
+     */
+    uint64_t m_currentTick{};
+    /**
+     * @brief - Closest expiration time point of stored timers, valid only if m_nextExpirationKnown is set
+     */
+    std::optional<Clock::time_point> m_nextExpiration{};
+    /**
+     * @brief - Defines, if m_nextExpiration is up to date, so slot does not have to be scanned again
+     */
+    bool m_nextExpirationKnown{true};
+    /**
+     * @brief - Number of stored timers
+     */
+    size_t m_size{};
+    /**
+     * @brief - Slots of all levels, followed by overflow slot
+     */
+    std::pmr::vector<std::pmr::vector<std::shared_ptr<Timer>>> m_slots;
+    /**
+     * @brief - Bitmap of non empty slots, per level
+     */
+    std::array<std::array<uint64_t, WORDS_PER_LEVEL>, LEVELS> m_occupied{};
+
+    /**
+     * @brief - Convert time point to wheel tick
+     */
+    [[nodiscard]] uint64_t toTick(Clock::time_point timePoint) const;
+    /**
+     * @brief - Get slot in which timer expiring at tick should be kept, regarding current wheel cursor
+     */
+    [[nodiscard]] size_t slotOf(uint64_t tick) const;
+    /**
+     * @brief - Get first tick covered by slot, regarding current wheel cursor
+     */
+    [[nodiscard]] uint64_t firstTickOf(size_t slot) const;
+    /**
+     * @brief - Put timer into slot matching its expiration time point
+     */
+    void place(std::shared_ptr<Timer> timer);
+    /**
+     * @brief - Remove timer kept at specified position of slot
+     */
+    void removeAt(size_t slot, size_t index);
+    /**
+     * @brief - Mark slot as (non) empty in occupancy bitmap
+     */
+    void setOccupied(size_t slot, bool occupied);
+    /**
+     * @brief - Find first non empty slot of level, starting from index
+     * @return - Slot number, std::nullopt if there is no such slot
+     */
+    [[nodiscard]] std::optional<size_t> findOccupied(size_t level, size_t fromIndex) const;
+    /**
+     * @brief - Find slot containing earliest expiring timers
+     */
+    [[nodiscard]] std::optional<size_t> findEarliestSlot() const;
+    /**
+     * @brief - Move all timers of slot again, regarding current wheel cursor
+     */
+    void cascade(size_t slot);
+    /**
+     * @brief - Move wheel cursor forward to tick, cascading passed slots
+     * @details - No timer may expire before tick
+     */
+    void advanceTo(uint64_t tick);
+    /**
+     * @brief - Remove timers of slot under cursor, expiring not later than time point
+     * @return - true if slot under cursor is empty afterwards
+     */
+    bool extractCurrentSlot(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers);
+
+public:
+    /**
+     * @brief - Timing wheel constructor
+     * @param resolution - Duration of single tick of lowest level
+     * @param resource - Memory resource from which slots are allocated
+     */
+    explicit TimingWheel(Clock::duration resolution = DEFAULT_RESOLUTION,
+                         std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    void insert(std::shared_ptr<Timer> timer) override;
+    bool erase(const std::shared_ptr<Timer>& timer) override;
+    size_t eraseIf(bool (*predicate)(Timer&)) override;
+    [[nodiscard]] bool contains(const std::shared_ptr<Timer>& timer) const override;
+    [[nodiscard]] size_t size() const override;
+    [[nodiscard]] std::optional<Clock::time_point> nextExpirationTimePoint() override;
+    void collectExpiringAt(Clock::time_point timePoint, std::pmr::list<std::shared_ptr<Timer>>& expiredTimers) override;
+    void extractExpired(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) override;
+};
+
+} // namespace Timers
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Internal/TimersAsyncLogger.hpp"
+#include "Internal/TimersAwaitable.hpp"
+#include "Internal/TimersEngine.hpp"
 #include "Internal/TimersError.hpp"
 #include "Internal/TimersHelpers.hpp"
 #include "Internal/TimersImplementation.hpp"
@@ -1,44 +1,226 @@
 #include "Internal//TimersActionsQueue.hpp"
+#include "Internal/TimersError.hpp"
+#include "Internal/TimersLogger.hpp"
 
 namespace Timers {
 
-ActionsQueue::ActionsQueue(ThreadControl& timersThreadControl, TimersCache& timersCache)
-    : m_timersThreadControl{timersThreadControl}, m_timersCache{timersCache} {}
-
-void ActionsQueue::push(TIMER_ACTION timerAction, std::shared_ptr<Timers::Timer> timer, std::function<void(uint8_t, bool)> callback) {
-    std::lock_guard lockGuard{this->m_mutex};
-    this->m_actionsQueue.emplace(timerAction, timer, callback);
-}
-
-void ActionsQueue::process() {
-    std::lock_guard lockGuard{this->m_mutex};
-    while (!m_actionsQueue.empty()) {
-        try {
-            auto& [action, timer, callback] = m_actionsQueue.front();
-            switch (action) {
-            case START:
-                m_timersCache.registerTimer(timer);
-                break;
-            case STOP:
-                m_timersCache.deleteTimer(timer);
-                break;
-            case RESTART:
-
-                std::cout << "Currently not supported" << std::endl;
-                break;
-            default:
-                std::cout << "Invalid actions" << std::endl;
-                break;
-            }
-            if (callback) {
-                callback(action, true);
-            }
-        } catch (std::exception& ex) {
-            std::cout << ex.what() << std::endl;
+/**
+ * @brief - Actions queue constructor
+ * @param timersThreadControl - Timers thread controller
+ * @param timersCache - Timers container on which actions are taken
+ * @param capacity - Number of pre-allocated nodes
+ * @param slabSchedule - Schedule of slab timers, on which handle actions are taken
+ * @param overflowResource - Thread-safe memory resource of nodes allocated above capacity
+ */
+ActionsQueue::ActionsQueue(ThreadControl& timersThreadControl, TimersCache& timersCache, size_t capacity, SlabSchedule* slabSchedule,
+                           std::pmr::memory_resource* overflowResource)
+    : m_timersThreadControl{timersThreadControl}, m_timersCache{timersCache}, m_slabSchedule{slabSchedule}, m_capacity{capacity},
+      m_nodes{std::make_unique<Node[]>(capacity)}, m_overflowResource{overflowResource} {
+    for (size_t i = 0; i < m_capacity; ++i) {
+        m_nodes[i].nextFree.store(i + 1 < m_capacity ? static_cast<uint32_t>(i + 2) : NO_NODE, std::memory_order_relaxed);
+    }
+    m_freeList.store(m_capacity > 0 ? 1 : NO_NODE, std::memory_order_relaxed);
+}
+
+/**
+ * @brief - Actions queue destructor, drops not processed actions
+ */
+ActionsQueue::~ActionsQueue() {
+    Node* node = m_pending.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+        Node* next = node->next;
+        if (!node->pooled) {
+            releaseNode(node);
+        }
+        node = next;
+    }
+}
+
+/**
+ * @brief - Take node from free list, or allocate it when free list is empty
+ */
+ActionsQueue::Node* ActionsQueue::acquireNode() {
+    uint64_t head = m_freeList.load(std::memory_order_acquire);
+    while (static_cast<uint32_t>(head) != NO_NODE) {
+        Node* node = &m_nodes[static_cast<uint32_t>(head) - 1];
+        // Tag is bumped on every change of free list, so node taken and returned meanwhile is detected
+        uint64_t newHead = ((head >> 32) + 1) << 32 | node->nextFree.load(std::memory_order_relaxed);
+        if (m_freeList.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+            return node;
         }
-        m_actionsQueue.pop();
     }
-    std::cout << "Processing finished" << std::endl;
+
+    auto node = new (m_overflowResource->allocate(sizeof(Node), alignof(Node))) Node{};
+    node->pooled = false;
+    return node;
+}
+
+/**
+ * @brief - Return node taken by acquireNode
+ */
+void ActionsQueue::releaseNode(Node* node) {
+    if (!node->pooled) {
+        node->~Node();
+        m_overflowResource->deallocate(node, sizeof(Node), alignof(Node));
+        return;
+    }
+
+    auto index = static_cast<uint32_t>(node - m_nodes.get()) + 1;
+    uint64_t head = m_freeList.load(std::memory_order_relaxed);
+    uint64_t newHead{};
+    do {
+        node->nextFree.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        newHead = ((head >> 32) + 1) << 32 | index;
+    } while (!m_freeList.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * @brief - Queue action, can be called from any thread
+ * @return - true if queue was empty before, so timers thread has to be woken up
+ */
+bool ActionsQueue::push(TIMER_ACTION timerAction, std::shared_ptr<Timers::Timer> timer, ActionCallback callback) {
+    Node* node = acquireNode();
+    node->action.emplace(timerAction, std::move(timer), std::move(callback));
+    return pushNode(node);
+}
+
+/**
+ * @brief - Queue action on slab timer, can be called from any thread
+ * @return - true if queue was empty before, so timers thread has to be woken up
+ */
+bool ActionsQueue::push(TIMER_ACTION timerAction, TimerId timerId, Clock::time_point timePoint) {
+    Node* node = acquireNode();
+    node->action.emplace(timerAction, timerId, timePoint);
+    return pushNode(node);
+}
+
+/**
+ * @brief - Queue action on batch of timers as single node, can be called from any thread
+ * @return - true if queue was empty before, so timers thread has to be woken up
+ */
+bool ActionsQueue::push(TIMER_ACTION timerAction, std::vector<std::shared_ptr<Timers::Timer>> timers, ActionCallback callback) {
+    Node* node = acquireNode();
+    node->action.emplace(timerAction, std::move(timers), std::move(callback));
+    return pushNode(node);
+}
+
+/**
+ * @brief - Put node with constructed action on pending stack
+ * @return - true if queue was empty before
+ */
+bool ActionsQueue::pushNode(Node* node) {
+    Node* head = m_pending.load(std::memory_order_relaxed);
+    do {
+        node->next = head;
+    } while (!m_pending.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+    return head == nullptr;
+}
+
+/**
+ * @brief - Check if there are actions waiting for processing
+ */
+bool ActionsQueue::hasPendingActions() const { return m_pending.load(std::memory_order_acquire) != nullptr; }
+
+/**
+ * @brief - Execute single action on timers container
+ */
+void ActionsQueue::execute(Action& action) {
+    try {
+        auto& timerAction = action.m_action;
+        auto& timer = action.m_timer;
+        auto& callback = action.m_callback;
+        switch (timerAction) {
+        case START:
+            m_timersCache.registerTimer(timer);
+            break;
+        case STOP:
+            m_timersCache.deleteTimer(timer);
+            break;
+        case RESCHEDULE:
+            m_timersCache.checkInTimer(timer, true);
+            break;
+        case RELEASE:
+            m_timersCache.checkInTimer(timer, false);
+            break;
+        case START_HANDLE:
+        case STOP_HANDLE:
+        case DESTROY_HANDLE:
+            executeHandleAction(action);
+            break;
+        case START_BATCH:
+            m_timersCache.registerTimers(action.m_timers);
+            break;
+        case STOP_BATCH:
+            m_timersCache.deleteTimers(action.m_timers);
+            break;
+        case RESTART:
+            m_timersCache.restartTimer(timer);
+            break;
+        default:
+            Logger::log<Logger::Level::Error>("Invalid timer action");
+            break;
+        }
+        if (callback) {
+            callback(timerAction, true);
+        }
+    } catch (std::exception& ex) {
+        Logger::log<Logger::Level::Error>(ex.what());
+        // Caller waiting for action is still released, with failure state
+        if (action.m_callback) {
+            action.m_callback(action.m_action, false);
+        }
+    }
+}
+
+/**
+ * @brief - Execute single action on slab timer
+ */
+void ActionsQueue::executeHandleAction(Action& action) {
+    if (!m_slabSchedule) {
+        throw TimerError("Timer handles are not supported by this queue");
+    }
+    switch (action.m_action) {
+    case START_HANDLE:
+        m_slabSchedule->arm(action.m_timerId, action.m_timePoint);
+        break;
+    case STOP_HANDLE:
+        m_slabSchedule->disarm(action.m_timerId);
+        break;
+    case DESTROY_HANDLE:
+        m_slabSchedule->destroy(action.m_timerId);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief - Process all queued actions, must be called only from timers thread
+ * @return - Number of processed actions
+ */
+size_t ActionsQueue::process() {
+    Node* batch = m_pending.exchange(nullptr, std::memory_order_acquire);
+
+    // Pending stack keeps most recent action on top, reverse it to process actions in order of pushing
+    Node* ordered{nullptr};
+    size_t processed{};
+    while (batch) {
+        Node* next = batch->next;
+        batch->next = ordered;
+        ordered = batch;
+        batch = next;
+        ++processed;
+    }
+
+    while (ordered) {
+        Node* next = ordered->next;
+        execute(*ordered->action);
+        ordered->action.reset();
+        releaseNode(ordered);
+        ordered = next;
+    }
+    Logger::log<Logger::Level::Trace>("Processing finished");
+    return processed;
 }
 
-} // namespace Timers
\ No newline at end of file
+} // namespace Timers
@@ -0,0 +1,138 @@
+#include "Internal/TimersAsyncLogger.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+
+namespace Timers {
+
+/**
+ * @brief - Asynchronous logger constructor, starts writing thread
+ * @param output - Stream to which messages are written, it has to outlive logger
+ * @param capacity - Number of ring buffer slots, rounded up to power of two
+ */
+AsyncLogger::AsyncLogger(std::ostream& output, size_t capacity)
+    : m_output{output}, m_mask{std::bit_ceil(std::max<size_t>(capacity, 2)) - 1}, m_slots{std::make_unique<Slot[]>(m_mask + 1)} {
+    for (size_t i = 0; i <= m_mask; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    m_writingThread = std::thread(&AsyncLogger::run, this);
+}
+
+/**
+ * @brief - Asynchronous logger destructor, writes all queued messages and stops writing thread
+ */
+AsyncLogger::~AsyncLogger() {
+    m_running.store(false, std::memory_order_release);
+    m_queued.fetch_add(1, std::memory_order_release);
+    m_queued.notify_one();
+    m_writingThread.join();
+}
+
+/**
+ * @brief - Queue message, can be called from any thread
+ * @param level - Level of message
+ * @param message - Message, truncated to MESSAGE_CAPACITY characters
+ */
+void AsyncLogger::operator()(Level level, std::string_view message) noexcept {
+    auto timePoint = Clock::now();
+    auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot{};
+    while (true) {
+        slot = &m_slots[position & m_mask];
+        auto difference = static_cast<int64_t>(slot->sequence.load(std::memory_order_acquire) - position);
+        if (difference == 0) {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // Slot was not written yet since previous lap, ring buffer is full
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    slot->timePoint = timePoint;
+    slot->length = static_cast<uint8_t>(std::min(message.size(), MESSAGE_CAPACITY));
+    std::memcpy(slot->message.data(), message.data(), slot->length);
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    m_queued.fetch_add(1, std::memory_order_release);
+    m_queued.notify_one();
+}
+
+/**
+ * @brief - Wait until all messages queued before call are written and output is flushed
+ */
+void AsyncLogger::flush() {
+    auto target = m_enqueuePosition.load(std::memory_order_acquire);
+    auto written = m_written.load(std::memory_order_acquire);
+    while (written < target) {
+        m_written.wait(written, std::memory_order_acquire);
+        written = m_written.load(std::memory_order_acquire);
+    }
+}
+
+/**
+ * @brief - Get number of messages dropped, because ring buffer was full
+ */
+uint64_t AsyncLogger::getDropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+/**
+ * @brief - Write queued messages until logger is destroyed
+ */
+void AsyncLogger::run() {
+    std::string buffer{};
+    while (true) {
+        auto queued = m_queued.load(std::memory_order_acquire);
+        auto taken = drain(buffer);
+        if (taken > 0) {
+            m_output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            m_output.flush();
+            buffer.clear();
+            m_written.fetch_add(taken, std::memory_order_release);
+            m_written.notify_all();
+            continue;
+        }
+        if (!m_running.load(std::memory_order_acquire)) {
+            break;
+        }
+        // Message published after queued counter was read changes it, so it is never missed
+        m_queued.wait(queued, std::memory_order_acquire);
+    }
+}
+
+/**
+ * @brief - Take all filled slots, and format them into buffer
+ * @return - Number of taken messages
+ */
+size_t AsyncLogger::drain(std::string& buffer) {
+    size_t taken{};
+    while (true) {
+        auto& slot = m_slots[m_dequeuePosition & m_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1) {
+            break;
+        }
+
+        auto sinceEpoch = std::chrono::duration_cast<std::chrono::microseconds>(slot.timePoint.time_since_epoch()).count();
+        char timeStamp[32]{};
+        std::snprintf(timeStamp, sizeof(timeStamp), "[%lld.%06lld] ", static_cast<long long>(sinceEpoch / 1000000),
+                      static_cast<long long>(sinceEpoch % 1000000));
+        buffer.append(timeStamp);
+        buffer.append(levelToString(slot.level));
+        buffer.push_back(' ');
+        buffer.append(slot.message.data(), slot.length);
+        buffer.push_back('\n');
+
+        // Slot becomes free for position of next lap
+        slot.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+        ++m_dequeuePosition;
+        ++taken;
+    }
+    return taken;
+}
+
+} // namespace Timers
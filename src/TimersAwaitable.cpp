@@ -0,0 +1,175 @@
+#include "Internal/TimersAwaitable.hpp"
+#include "Internal/TimersManager.hpp"
+
+namespace Timers {
+
+/**
+ * @brief - Timer node constructor
+ * @param awaitable - Awaitable owning node
+ * @param expirationTimePoint - Time point until which coroutine waits
+ */
+SleepAwaitable::Node::Node(SleepAwaitable& awaitable, Clock::time_point expirationTimePoint) : m_awaitable{awaitable} {
+    setExpirationTimePoint(expirationTimePoint);
+}
+
+/**
+ * @brief - Resume awaiting coroutine, unless waiting was cancelled
+ * @return - Always return delete code, awaitable may be gone once coroutine was resumed
+ */
+Timer::CallbackAction SleepAwaitable::Node::run() {
+    // Timer's own states are hidden here by ones of awaitable
+    auto& state = m_awaitable.m_state;
+    auto current = state.load(std::memory_order_acquire);
+    while (true) {
+        if (current == SleepAwaitable::ARMED) {
+            if (state.compare_exchange_weak(current, SleepAwaitable::EXPIRED, std::memory_order_acq_rel)) {
+                m_awaitable.resume();
+                break;
+            }
+        } else if (current == SleepAwaitable::IDLE) {
+            // Awaiter still registers timer, it will not suspend coroutine at all
+            if (state.compare_exchange_weak(current, SleepAwaitable::EXPIRED_EARLY, std::memory_order_acq_rel)) {
+                break;
+            }
+        } else {
+            break;
+        }
+    }
+    return CallbackAction::DELETE;
+}
+
+/**
+ * @brief - Awaitable constructor
+ * @param expirationTimePoint - Time point until which coroutine waits
+ * @param stopToken - Token cancelling waiting
+ * @param executor - Executor resuming coroutine, nullptr resumes it on timers thread
+ */
+SleepAwaitable::SleepAwaitable(Clock::time_point expirationTimePoint, std::stop_token stopToken, CoroutineExecutor* executor)
+    : m_node{*this, expirationTimePoint}, m_executor{executor}, m_stopToken{std::move(stopToken)} {
+    // Node must not be touched once coroutine was resumed, so it is never handed over to executor threads
+    m_node.dispatchInline = true;
+    // Budget is not taken from TimersManager, as node is not touched after coroutine was resumed
+    m_node.setExecutionBudget(Clock::duration::zero());
+}
+
+/**
+ * @brief - Get timer node registered in cache, without owning it
+ */
+std::shared_ptr<Timer> SleepAwaitable::node() { return std::shared_ptr<Timer>{std::shared_ptr<Timer>{}, &m_node}; }
+
+/**
+ * @brief - Resume awaiting coroutine on executor, or on calling thread
+ */
+void SleepAwaitable::resume() {
+    if (m_executor) {
+        m_executor->post(m_handle);
+    } else {
+        m_handle.resume();
+    }
+}
+
+/**
+ * @brief - Remove timer from cache, and resume coroutine once it was removed
+ */
+void SleepAwaitable::remove() {
+    TimersManager::eraseTimer(node(), [this](uint8_t, bool) { resume(); });
+}
+
+/**
+ * @brief - Cancel waiting, called on thread requesting stop
+ */
+void SleepAwaitable::cancel() noexcept {
+    auto current = m_state.load(std::memory_order_acquire);
+    while (true) {
+        if (current == ARMED) {
+            if (m_state.compare_exchange_weak(current, CANCELLED, std::memory_order_acq_rel)) {
+                try {
+                    remove();
+                } catch (std::exception& ex) {
+                    Logger::log<Logger::Level::Error>(ex.what());
+                }
+                break;
+            }
+        } else if (current == IDLE) {
+            // Awaiter still registers timer, it removes it by itself
+            if (m_state.compare_exchange_weak(current, CANCELLED_EARLY, std::memory_order_acq_rel)) {
+                break;
+            }
+        } else {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief - Check if waiting is not needed, time point passed or stop was already requested
+ */
+bool SleepAwaitable::await_ready() const noexcept {
+    return m_stopToken.stop_requested() || !(Clock::now() < m_node.getExpirationTimePoint());
+}
+
+/**
+ * @brief - Register timer in TimersManager
+ * @param handle - Awaiting coroutine
+ * @return - false if timer already expired, so coroutine is not suspended
+ */
+bool SleepAwaitable::await_suspend(std::coroutine_handle<> handle) {
+    m_handle = handle;
+    if (m_stopToken.stop_possible()) {
+        m_stopCallback.emplace(m_stopToken, Canceller{this});
+    }
+    if (m_state.load(std::memory_order_acquire) == CANCELLED_EARLY) {
+        return false;
+    }
+
+    TimersManager::addTimer(node(), nullptr);
+    // Once timer is armed, awaitable belongs to timers thread and to canceller, it must not be touched here anymore
+    auto expected = IDLE;
+    if (m_state.compare_exchange_strong(expected, ARMED, std::memory_order_acq_rel)) {
+        return true;
+    }
+    if (expected == EXPIRED_EARLY) {
+        return false;
+    }
+    remove();
+    return true;
+}
+
+/**
+ * @brief - Finish waiting
+ * @return - true if time point was reached, false if waiting was cancelled
+ */
+bool SleepAwaitable::await_resume() noexcept {
+    m_stopCallback.reset();
+    switch (m_state.load(std::memory_order_acquire)) {
+    case EXPIRED:
+    case EXPIRED_EARLY:
+        return true;
+    case IDLE:
+        return !m_stopToken.stop_requested();
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief - Suspend coroutine for duration, co_await returns false if waiting was cancelled
+ * @param duration - Duration of waiting
+ * @param stopToken - Token cancelling waiting
+ * @param executor - Executor resuming coroutine, nullptr resumes it on timers thread
+ */
+SleepAwaitable sleep_for(Clock::duration duration, std::stop_token stopToken, CoroutineExecutor* executor) {
+    return SleepAwaitable{Clock::now() + duration, std::move(stopToken), executor};
+}
+
+/**
+ * @brief - Suspend coroutine until time point, co_await returns false if waiting was cancelled
+ * @param timePoint - Time point until which coroutine waits
+ * @param stopToken - Token cancelling waiting
+ * @param executor - Executor resuming coroutine, nullptr resumes it on timers thread
+ */
+SleepAwaitable sleep_until(Clock::time_point timePoint, std::stop_token stopToken, CoroutineExecutor* executor) {
+    return SleepAwaitable{timePoint, std::move(stopToken), executor};
+}
+
+} // namespace Timers
@@ -1,64 +1,165 @@
 #include "Internal/TimersCache.hpp"
 #include "Internal/TimersError.hpp"
+#include "Internal/TimersHeap.hpp"
+#include "Internal/TimersTimingWheel.hpp"
+#include <algorithm>
 #include <thread>
+#include <utility>
 
 namespace Timers {
 
+/**
+ * @brief - Create cache keeping timers in multimap
+ */
+TimersCache::TimersCache() : TimersCache(CacheBackend::MULTIMAP) {}
+
+/**
+ * @brief - Create cache keeping timers in specified backend
+ * @param backend - Data structure in which timers are kept
+ * @param upstream - Memory resource from which pool of cache takes its chunks
+ */
+TimersCache::TimersCache(CacheBackend backend, std::pmr::memory_resource* upstream)
+    : m_pool{upstream}, m_coalescingCandidates{&m_pool}, m_lanes(PRIORITY_LANES, &m_pool) {
+    switch (backend) {
+    case CacheBackend::TIMING_WHEEL:
+        m_storage = std::make_unique<TimingWheel>(TimingWheel::DEFAULT_RESOLUTION, &m_pool);
+        break;
+    case CacheBackend::HEAP:
+        m_storage = std::make_unique<TimersHeap>(&m_pool);
+        break;
+    case CacheBackend::MULTIMAP:
+    default:
+        m_storage = std::make_unique<MultimapStorage>(&m_pool);
+        break;
+    }
+}
+
 /**
  * @brief - If timer is not registered yet, add it to container
+ * @details - Timer taken out of cache is registered once it is returned, so it never runs concurrently with itself
  * @param timer - Timer to register
  */
 void TimersCache::registerTimer(std::shared_ptr<Timer> timer) {
-    if (timer && !isTimerRegistered(timer)) {
-        m_timers.insert(std::make_pair(timer->getExpirationTimePoint(), timer));
+    if (timer && timer->checkedOut && !isTimerRegistered(timer)) {
+        // Callback may still run on executor, timer is registered once it is returned
+        timer->deletedWhileCheckedOut = false;
+        timer->startedWhileCheckedOut = true;
+    } else if (timer && !isTimerRegistered(timer)) {
+        timer->deletedWhileCheckedOut = false;
+        m_coalescing = m_coalescing || timer->getSlack() != Clock::duration::zero();
+        m_storage->insert(std::move(timer));
     } else {
         throw TimerError("Timer registration failure");
     }
 }
 
+/**
+ * @brief - Add batch of timers to container, timers which are already registered are skipped
+ * @param timers - Timers to register
+ * @return - Number of registered timers
+ */
+size_t TimersCache::registerTimers(std::span<const std::shared_ptr<Timer>> timers) {
+    if (std::any_of(std::begin(timers), std::end(timers), [](const std::shared_ptr<Timer>& timer) { return !timer; })) {
+        throw TimerError("Timer is not initialized - nullptr");
+    }
+    auto checkedOut{false};
+    for (const auto& timer : timers) {
+        timer->deletedWhileCheckedOut = false;
+        timer->startedWhileCheckedOut = timer->checkedOut;
+        checkedOut = checkedOut || timer->checkedOut;
+        m_coalescing = m_coalescing || timer->getSlack() != Clock::duration::zero();
+    }
+    if (!checkedOut) {
+        return m_storage->insertBatch(timers);
+    }
+    // Timers taken out of cache are registered once they are returned
+    size_t registered{};
+    for (const auto& timer : timers) {
+        if (!timer->checkedOut && !isTimerRegistered(timer)) {
+            m_storage->insert(timer);
+            ++registered;
+        }
+    }
+    return registered;
+}
+
 /**
  * @brief - Delete timer from container
  * @param timer - Timer to delete
  */
 void TimersCache::deleteTimer(std::shared_ptr<Timer> timer) {
     if (timer) {
-        auto expirationTimePoint = timer->getExpirationTimePoint();
-
-        if (m_timers.contains(expirationTimePoint)) {
-            auto range = this->m_timers.equal_range(expirationTimePoint);
-            for (auto it = range.first; it != range.second; ++it) {
-                if (it->second == timer) {
-                    m_timers.erase(it);
-                    break;
-                }
-            }
+        if (!m_storage->erase(timer) && timer->checkedOut) {
+            timer->deletedWhileCheckedOut = true;
+            timer->startedWhileCheckedOut = false;
+            timer->restartedWhileCheckedOut = false;
         }
     } else {
         throw TimerError("Timer is not initialized - nullptr");
     }
 }
 
+/**
+ * @brief - Delete batch of timers from container
+ * @param timers - Timers to delete
+ */
+void TimersCache::deleteTimers(std::span<const std::shared_ptr<Timer>> timers) {
+    for (const auto& timer : timers) {
+        deleteTimer(timer);
+    }
+}
+
+/**
+ * @brief - Restart timer in container, it expires after its duration from now. Not registered timer is registered
+ * @details - Timer taken out of cache is restarted once it is returned
+ * @param timer - Timer to restart
+ */
 void TimersCache::restartTimer(std::shared_ptr<Timer> timer) {
-    if (timer) {
-        auto expirationTimePoint = timer->getExpirationTimePoint();
-
-        if (m_timers.contains(expirationTimePoint)) {
-            auto range = this->m_timers.equal_range(expirationTimePoint);
-            for (auto it = range.first; it != range.second; ++it) {
-                if (it->second == timer) {
-                    m_timers.erase(it);
-                    auto newExpirationTimePoint = std::chrono::high_resolution_clock::now() + timer->getDuration();
-                    timer->setExpirationTimePoint(newExpirationTimePoint);
-                    m_timers.insert(std::make_pair(timer->getExpirationTimePoint(), timer));
-                    break;
-                }
-            }
-        }
+    if (timer && timer->checkedOut) {
+        // Callback may still run on executor, which moves expiration of repeatable timer, so restart waits for its return
+        timer->deletedWhileCheckedOut = false;
+        timer->restartedWhileCheckedOut = true;
+    } else if (timer) {
+        m_storage->erase(timer);
+        // Tombstone is cleared on timers thread, so cancelled run is never executed at its old expiration time point
+        timer->revive();
+        timer->restart();
+        timer->deletedWhileCheckedOut = false;
+        m_coalescing = m_coalescing || timer->getSlack() != Clock::duration::zero();
+        m_storage->insert(std::move(timer));
     } else {
         throw TimerError("Timer is not initialized - nullptr");
     }
 }
 
+/**
+ * @brief - Remove lazily cancelled timers before their expiration
+ * @param timePoint - Current time point
+ * @return - Number of removed timers
+ */
+size_t TimersCache::compact(Clock::time_point timePoint) {
+    auto cancellations = Timer::cancellations.load(std::memory_order_relaxed);
+    if (m_compactionInterval == Clock::duration::zero() || cancellations == m_compactedCancellations ||
+        timePoint - m_lastCompaction < m_compactionInterval) {
+        return 0;
+    }
+    m_compactedCancellations = cancellations;
+    m_lastCompaction = timePoint;
+    return m_storage->eraseIf([](Timer& timer) {
+        if (!timer.cancelled.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        timer.discard();
+        return true;
+    });
+}
+
+/**
+ * @brief - Set minimal interval between compactions of lazily cancelled timers
+ * @param interval - Interval, zero disables compaction
+ */
+void TimersCache::setCompactionInterval(Clock::duration interval) { m_compactionInterval = interval; }
+
 /**
  * @brief - Check if timer is registered
  * @param timer - Timer to check
@@ -67,17 +168,7 @@ void TimersCache::restartTimer(std::shared_ptr<Timer> timer) {
 bool TimersCache::isTimerRegistered(std::shared_ptr<Timer> timer) {
     auto alreadyRegistered{false};
     if (timer) {
-        auto expirationTimePoint = timer->getExpirationTimePoint();
-
-        if (m_timers.contains(expirationTimePoint)) {
-            auto range = this->m_timers.equal_range(expirationTimePoint);
-            for (auto it = range.first; it != range.second; ++it) {
-                if (it->second == timer) {
-                    alreadyRegistered = true;
-                    break;
-                }
-            }
-        }
+        alreadyRegistered = m_storage->contains(timer);
     } else {
         throw TimerError("Timer is null");
     }
@@ -88,30 +179,148 @@ bool TimersCache::isTimerRegistered(std::shared_ptr<Timer> timer) {
  * @brief - Get number of registered timers in container
  * @return - number of timers
  */
-size_t TimersCache::size() const { return this->m_timers.size(); }
+size_t TimersCache::size() const { return this->m_storage->size(); }
 
 /**
- * @brief - Get closest expiration time point of timer registered in container
+ * @brief - Get closest expiration time point of timer registered in container, delayed by its slack
  * @return - Closest expiration time point
  */
-std::optional<std::chrono::high_resolution_clock::time_point> TimersCache::getNextExpirationTimePoint() {
-    std::optional<std::chrono::high_resolution_clock::time_point> nextExpiration{std::nullopt};
-    if (!m_timers.empty()) {
-        nextExpiration = std::begin(this->m_timers)->first;
-    }
-    return nextExpiration;
+std::optional<Clock::time_point> TimersCache::getNextExpirationTimePoint() {
+    return this->m_storage->nextExpirationTimePoint();
 }
 
-std::list<std::shared_ptr<Timer>> TimersCache::getTimersExpiringAt(std::chrono::high_resolution_clock::time_point timePoint) {
-    std::list<std::shared_ptr<Timer>> expiredTimers{};
+/**
+ * @brief - Get all expired timers, in specified point of time
+ * @param timePoint - Time point
+ * @param resource - Memory resource from which returned list is allocated
+ * @return - All timers from specified point of time, highest priority lane first
+ */
+std::pmr::list<std::shared_ptr<Timer>> TimersCache::getTimersExpiringAt(Clock::time_point timePoint, std::pmr::memory_resource* resource) {
+    std::pmr::list<std::shared_ptr<Timer>> expiredTimers{resource};
+    this->m_storage->collectExpiringAt(timePoint, expiredTimers);
 
-    auto range = this->m_timers.equal_range(timePoint);
-    for (auto it = range.first; it != range.second; ++it) {
-        expiredTimers.emplace_back(it->second);
+    // Nodes are only spliced between lanes, so timers are neither compared nor copied. Splicing requires lanes
+    // to share memory resource of returned list
+    std::pmr::vector<std::pmr::list<std::shared_ptr<Timer>>> lanes(PRIORITY_LANES, resource);
+    while (!expiredTimers.empty()) {
+        auto& lane = lanes[priorityLane(expiredTimers.front()->getPriority())];
+        lane.splice(std::end(lane), expiredTimers, std::begin(expiredTimers));
+    }
+    for (auto lane = PRIORITY_LANES; lane > 0; --lane) {
+        expiredTimers.splice(std::end(expiredTimers), lanes[lane - 1]);
     }
-    expiredTimers.sort(
-        [](const std::shared_ptr<Timer> first, std::shared_ptr<Timer> second) { return first->getPriority() > second->getPriority(); });
     return expiredTimers;
 }
 
+/**
+ * @brief - Remove all timers expiring not later than specified point of time
+ * @param timePoint - Time point
+ * @param expiredTimers - Vector to which removed timers are appended, ordered by expiration and priority
+ */
+void TimersCache::extractExpiredTimers(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) {
+    auto firstExpired = static_cast<std::ptrdiff_t>(expiredTimers.size());
+    this->m_storage->extractExpired(timePoint, expiredTimers);
+    while (m_coalescing) {
+        auto nextExpirationTimePoint = this->m_storage->nextExpirationTimePoint();
+        if (!nextExpirationTimePoint.has_value()) {
+            break;
+        }
+        // Timers are ordered by latest expiration, next group may be taken only if all of its timers already expired
+        m_coalescingCandidates.clear();
+        this->m_storage->collectExpiringAt(*nextExpirationTimePoint, m_coalescingCandidates);
+        auto expired = std::all_of(std::begin(m_coalescingCandidates), std::end(m_coalescingCandidates),
+                                   [timePoint](const std::shared_ptr<Timer>& timer) { return !(timePoint < timer->getExpirationTimePoint()); });
+        m_coalescingCandidates.clear();
+        if (!expired) {
+            break;
+        }
+        this->m_storage->extractExpired(*nextExpirationTimePoint, expiredTimers);
+        m_savedWakeUps.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Lazy cancellation and extension are applied only now, when previous expiration time point was reached
+    auto kept = static_cast<size_t>(firstExpired);
+    std::array<size_t, PRIORITY_LANES> laneSizes{};
+    for (auto index = kept; index < expiredTimers.size(); ++index) {
+        auto& timer = expiredTimers[index];
+        if (timer->cancelled.load(std::memory_order_relaxed)) {
+            timer->discard();
+            continue;
+        }
+        auto extendedExpiration = timer->extendedExpiration.exchange(0, std::memory_order_relaxed);
+        if (extendedExpiration > timer->getExpirationTimePoint().time_since_epoch().count()) {
+            timer->startTimePoint = Clock::time_point{Clock::duration{extendedExpiration}} - timer->duration;
+            if (timePoint < timer->getExpirationTimePoint()) {
+                m_storage->insert(std::move(timer));
+                continue;
+            }
+        }
+        timer->firingTimePoint = timePoint;
+        laneSizes[priorityLane(timer->getPriority())]++;
+        if (index != kept) {
+            expiredTimers[kept] = std::move(timer);
+        }
+        ++kept;
+    }
+    expiredTimers.resize(kept);
+    auto usedLanes = std::count_if(std::begin(laneSizes), std::end(laneSizes), [](size_t size) { return size > 0; });
+    if (usedLanes <= 1) {
+        return;
+    }
+
+    // Storages extract timers in order of expiration, which is kept within lane, lanes are drained highest first
+    for (auto index = static_cast<size_t>(firstExpired); index < expiredTimers.size(); ++index) {
+        m_lanes[priorityLane(expiredTimers[index]->getPriority())].emplace_back(std::move(expiredTimers[index]));
+    }
+    auto position = std::begin(expiredTimers) + firstExpired;
+    for (auto lane = PRIORITY_LANES; lane > 0; --lane) {
+        position = std::move(std::begin(m_lanes[lane - 1]), std::end(m_lanes[lane - 1]), position);
+        m_lanes[lane - 1].clear();
+    }
+}
+
+/**
+ * @brief - Mark expired timer as taken out of cache, for execution on other thread
+ * @param timer - Expired timer
+ */
+void TimersCache::checkOutTimer(const std::shared_ptr<Timer>& timer) {
+    if (timer) {
+        timer->checkedOut = true;
+        timer->deletedWhileCheckedOut = false;
+        timer->startedWhileCheckedOut = false;
+        timer->restartedWhileCheckedOut = false;
+    } else {
+        throw TimerError("Timer is not initialized - nullptr");
+    }
+}
+
+/**
+ * @brief - Return timer taken out of cache after its execution
+ * @details - Timer is registered again only if it should keep ticking, and was not deleted meanwhile,
+ *            or if it was started or restarted while it was taken out
+ * @param timer - Executed timer
+ * @param keepRegistered - Defines, if timer should be registered again
+ */
+void TimersCache::checkInTimer(std::shared_ptr<Timer> timer, bool keepRegistered) {
+    if (timer) {
+        timer->checkedOut = false;
+        if (std::exchange(timer->restartedWhileCheckedOut, false)) {
+            timer->startedWhileCheckedOut = false;
+            restartTimer(std::move(timer));
+        } else if ((std::exchange(timer->startedWhileCheckedOut, false) || (keepRegistered && !timer->deletedWhileCheckedOut)) &&
+                   !isTimerRegistered(timer)) {
+            m_coalescing = m_coalescing || timer->getSlack() != Clock::duration::zero();
+            m_storage->insert(std::move(timer));
+        }
+    } else {
+        throw TimerError("Timer is not initialized - nullptr");
+    }
+}
+
+/**
+ * @brief - Get number of wake ups, which were avoided by executing timers within their slack
+ * @return - Number of saved wake ups
+ */
+uint64_t TimersCache::getSavedWakeUps() const { return m_savedWakeUps.load(std::memory_order_relaxed); }
+
 } // namespace Timers
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "Internal/TimersClock.hpp"
+#ifdef __linux__
+#include <ctime>
+#endif
+
+namespace Timers {
+
+std::atomic<ClockSource> Clock::source{ClockSource::STEADY};
+
+std::atomic<Clock::rep> Clock::virtualTime{};
+
+/**
+ * @brief - Read clock, which is not virtual
+ */
+Clock::time_point Clock::readSource(ClockSource clockSource) noexcept {
+#ifdef __linux__
+    if (clockSource == ClockSource::COARSE) {
+        timespec time{};
+        clock_gettime(CLOCK_MONOTONIC_COARSE, &time);
+        return time_point{std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec)};
+    }
+#else
+    (void)clockSource;
+#endif
+    return time_point{std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch())};
+}
+
+/**
+ * @brief - Select source of time. Virtual clock starts at current steady time
+ * @param clockSource - New source of time
+ */
+void Clock::setSource(ClockSource clockSource) noexcept {
+    if (clockSource == ClockSource::VIRTUAL && source.load() != ClockSource::VIRTUAL) {
+        virtualTime.store(readSource(ClockSource::STEADY).time_since_epoch().count(), std::memory_order_release);
+    }
+    source.store(clockSource);
+}
+
+/**
+ * @brief - Get selected source of time
+ */
+ClockSource Clock::getSource() noexcept { return source.load(std::memory_order_relaxed); }
+
+/**
+ * @brief - Get resolution of selected source, zero for steady and virtual clocks
+ */
+Clock::duration Clock::getResolution() noexcept {
+#ifdef __linux__
+    if (getSource() == ClockSource::COARSE) {
+        static const duration coarseResolution = []() {
+            timespec resolution{};
+            clock_getres(CLOCK_MONOTONIC_COARSE, &resolution);
+            return duration{std::chrono::seconds(resolution.tv_sec) + std::chrono::nanoseconds(resolution.tv_nsec)};
+        }();
+        return coarseResolution;
+    }
+#endif
+    return duration::zero();
+}
+
+/**
+ * @brief - Move virtual clock forward
+ * @param step - Duration by which clock is moved, negative durations are ignored
+ */
+void Clock::advance(duration step) noexcept {
+    if (step > duration::zero()) {
+        virtualTime.fetch_add(step.count(), std::memory_order_acq_rel);
+    }
+}
+
+/**
+ * @brief - Move virtual clock to time point, clock is never moved backwards
+ * @param timePoint - New time of virtual clock
+ */
+void Clock::advanceTo(time_point timePoint) noexcept {
+    auto current = virtualTime.load(std::memory_order_relaxed);
+    while (current < timePoint.time_since_epoch().count() &&
+           !virtualTime.compare_exchange_weak(current, timePoint.time_since_epoch().count(), std::memory_order_acq_rel)) {
+    }
+}
+
+} // namespace Timers
@@ -0,0 +1,222 @@
+#include "Internal/TimersEngine.hpp"
+#include "Internal/TimersError.hpp"
+#include <algorithm>
+
+namespace Timers {
+
+/**
+ * @brief - Engine constructor
+ * @param cacheBackend - Data structure in which engine keeps registered timers
+ * @param actionsQueueCapacity - Number of pre-allocated actions queue nodes
+ * @param collectStatistics - Defines, if poll collects statistics of firing lateness and actions
+ * @param memoryResource - Upstream of pool from which timers container allocates its nodes, and resource of
+ *                         actions above queue capacity. Has to be thread-safe and has to outlive engine
+ */
+TimersEngine::TimersEngine(CacheBackend cacheBackend, size_t actionsQueueCapacity, bool collectStatistics,
+                           std::pmr::memory_resource* memoryResource)
+    : m_shard{cacheBackend, actionsQueueCapacity, m_slab, WaitBackend::CONDITION_VARIABLE, WaitMode::SLEEP, {}, memoryResource},
+      m_nextDeadline{NO_DEADLINE} {
+    if (collectStatistics) {
+        m_shard.statistics = std::make_unique<TimersStatistics>();
+    }
+}
+
+/**
+ * @brief - Set function waking up event loop, when added timer moves next deadline earlier
+ * @details - Function is called on thread adding timer. It has to be set before timers are added from other threads
+ * @param wakeUp - Function waking up event loop, for example by writing to its eventfd
+ */
+void TimersEngine::setWakeUp(WakeUpCallback wakeUp) { m_wakeUp = std::move(wakeUp); }
+
+/**
+ * @brief - Register new timer, it is started on next poll
+ * @param timer - Timer to register
+ * @param callback - Function called from poll, after timer was registered
+ */
+void TimersEngine::addTimer(std::shared_ptr<Timer> timer, ActionCallback callback) {
+    if (!timer) {
+        throw TimerError("Timer is not initialized - nullptr");
+    }
+    timer->revive();
+    // Cache publishes expiration delayed by slack, so slack of added timer is kept for coalescing
+    auto deadline = timer->getLatestExpirationTimePoint();
+    m_shard.actionsQueue.push(TIMER_ACTION::START, std::move(timer), std::move(callback));
+    lowerNextDeadline(deadline, true);
+}
+
+/**
+ * @brief - Remove timer, it is stopped on next poll
+ * @param timer - Timer to erase
+ */
+void TimersEngine::eraseTimer(std::shared_ptr<Timer> timer) {
+    if (!timer) {
+        throw TimerError("Timer is not initialized - nullptr");
+    }
+    m_shard.actionsQueue.push(TIMER_ACTION::STOP, std::move(timer), nullptr);
+}
+
+/**
+ * @brief - Restart timer, it expires after its duration from now. Lazily cancelled timer is started again
+ * @param timer - Timer to restart
+ */
+void TimersEngine::restartTimer(std::shared_ptr<Timer> timer) {
+    if (!timer) {
+        throw TimerError("Timer is not initialized - nullptr");
+    }
+    // Timer is restarted on next poll, so it does not expire before its duration from now
+    auto deadline = Clock::now() + timer->getDuration() + timer->getSlack();
+    m_shard.actionsQueue.push(TIMER_ACTION::RESTART, std::move(timer), nullptr);
+    lowerNextDeadline(deadline, true);
+}
+
+/**
+ * @brief - Register batch of timers as single action, they are started on next poll
+ * @param timers - Timers to register
+ * @param callback - Function called from poll, after batch was registered
+ */
+void TimersEngine::addTimers(std::span<const std::shared_ptr<Timer>> timers, ActionCallback callback) {
+    if (std::any_of(std::begin(timers), std::end(timers), [](const std::shared_ptr<Timer>& timer) { return !timer; })) {
+        throw TimerError("Timer is not initialized - nullptr");
+    }
+    auto deadline = Clock::time_point::max();
+    for (const auto& timer : timers) {
+        timer->revive();
+        deadline = std::min(deadline, timer->getLatestExpirationTimePoint());
+    }
+    m_shard.actionsQueue.push(TIMER_ACTION::START_BATCH, std::vector<std::shared_ptr<Timer>>(std::begin(timers), std::end(timers)),
+                              std::move(callback));
+    lowerNextDeadline(deadline, true);
+}
+
+/**
+ * @brief - Remove batch of timers as single action, they are stopped on next poll
+ * @param timers - Timers to erase
+ */
+void TimersEngine::eraseTimers(std::span<const std::shared_ptr<Timer>> timers) {
+    if (std::any_of(std::begin(timers), std::end(timers), [](const std::shared_ptr<Timer>& timer) { return !timer; })) {
+        throw TimerError("Timer is not initialized - nullptr");
+    }
+    m_shard.actionsQueue.push(TIMER_ACTION::STOP_BATCH, std::vector<std::shared_ptr<Timer>>(std::begin(timers), std::end(timers)),
+                              nullptr);
+}
+
+/**
+ * @brief - Create timer addressed by handle
+ * @param callback - Function called on timer expiration, from poll
+ * @param context - Argument of callback
+ * @param interval - Duration of timer ticking, period of repeatable timer
+ * @param repeatable - Defines, if timer keeps ticking after expiration
+ * @return - Handle of created timer
+ */
+TimerId TimersEngine::createTimer(TimerFunction callback, void* context, Clock::duration interval, bool repeatable) {
+    return m_slab.create(callback, context, interval, repeatable);
+}
+
+/**
+ * @brief - Start timer addressed by handle, it expires after its interval from now
+ * @param timerId - Handle of timer
+ */
+void TimersEngine::startTimer(TimerId timerId) {
+    auto record = m_slab.find(timerId);
+    if (!record) {
+        throw TimerError("Timer handle is stale");
+    }
+    auto deadline = Clock::now() + record->interval;
+    m_shard.actionsQueue.push(TIMER_ACTION::START_HANDLE, timerId, deadline);
+    lowerNextDeadline(deadline, true);
+}
+
+/**
+ * @brief - Stop timer addressed by handle
+ * @param timerId - Handle of timer
+ */
+void TimersEngine::stopTimer(TimerId timerId) { m_shard.actionsQueue.push(TIMER_ACTION::STOP_HANDLE, timerId, {}); }
+
+/**
+ * @brief - Stop and release timer addressed by handle, handle becomes stale
+ * @param timerId - Handle of timer
+ */
+void TimersEngine::destroyTimer(TimerId timerId) { m_shard.actionsQueue.push(TIMER_ACTION::DESTROY_HANDLE, timerId, {}); }
+
+/**
+ * @brief - Get closest expiration time point, of timers registered by last poll and timers added since.
+ *          Lock-free, may be called from any thread
+ * @return - Closest expiration time point, std::nullopt if there are no timers
+ */
+std::optional<Clock::time_point> TimersEngine::nextDeadline() const {
+    auto nextDeadline = m_nextDeadline.load(std::memory_order_acquire);
+    if (nextDeadline == NO_DEADLINE) {
+        return std::nullopt;
+    }
+    return Clock::time_point{Clock::duration{nextDeadline}};
+}
+
+/**
+ * @brief - Check if there are added or erased timers, which will be applied on next poll
+ */
+bool TimersEngine::hasPendingActions() const { return m_shard.actionsQueue.hasPendingActions(); }
+
+/**
+ * @brief - Apply pending actions, and execute all timers expired until time point
+ * @param now - Current time point
+ * @return - Number of executed timers
+ */
+size_t TimersEngine::poll(Clock::time_point now) {
+    TimersRunner::process(m_shard);
+    auto executed = m_runner.expire(m_shard, nullptr, now);
+    updateNextDeadline(now);
+    return executed;
+}
+
+/**
+ * @brief - Get number of registered timers, both shared and addressed by handles
+ */
+size_t TimersEngine::size() const { return m_shard.timersCache.size() + m_shard.slabSchedule.size(); }
+
+/**
+ * @brief - Get statistics collected by poll, may be called from any thread
+ * @return - Statistics, wake ups are not counted as engine does not wait
+ */
+TimersStatisticsSnapshot TimersEngine::getStatistics() const {
+    if (!m_shard.statistics) {
+        throw TimerError("Statistics are not collected, enable them in engine constructor");
+    }
+    return m_shard.statistics->snapshot();
+}
+
+/**
+ * @brief - Publish closest expiration time point of registered timers
+ * @param now - Time point of poll, published if actions were queued meanwhile
+ */
+void TimersEngine::updateNextDeadline(Clock::time_point now) {
+    auto nextExpirationTimePoint = m_shard.getNextExpirationTimePoint();
+    m_nextDeadline.store(nextExpirationTimePoint.has_value() ? nextExpirationTimePoint->time_since_epoch().count() : NO_DEADLINE,
+                         std::memory_order_seq_cst);
+    // Timer added after actions were processed may have lowered deadline just overwritten, so next poll is due at once
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_shard.actionsQueue.hasPendingActions()) {
+        lowerNextDeadline(now, false);
+    }
+}
+
+/**
+ * @brief - Move next deadline to expiration time point of added timer, if it is earlier
+ * @param deadline - Expiration time point of added timer
+ * @param wakeUp - Defines, if wake up callback is called when deadline moved
+ */
+void TimersEngine::lowerNextDeadline(Clock::time_point deadline, bool wakeUp) {
+    // Pairs with fence of poll, either poll sees queued action or this thread sees deadline stored by poll
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto requested = deadline.time_since_epoch().count();
+    auto current = m_nextDeadline.load(std::memory_order_relaxed);
+    while (requested < current) {
+        if (m_nextDeadline.compare_exchange_weak(current, requested, std::memory_order_acq_rel)) {
+            if (wakeUp && m_wakeUp) {
+                m_wakeUp(deadline);
+            }
+            return;
+        }
+    }
+}
+
+} // namespace Timers
@@ -0,0 +1,96 @@
+#include "Internal/TimersExecutor.hpp"
+#include <algorithm>
+
+namespace Timers {
+
+/**
+ * @brief - Executor constructor
+ * @param threadsCount - Number of worker threads, at least one is always started
+ * @param completionHandler - Function called after every executed timer
+ */
+TimersExecutor::TimersExecutor(size_t threadsCount, CompletionHandler completionHandler)
+    : m_threadsCount{std::max<size_t>(threadsCount, 1)}, m_completionHandler{std::move(completionHandler)} {}
+
+/**
+ * @brief - Executor destructor, stops worker threads
+ */
+TimersExecutor::~TimersExecutor() { stop(); }
+
+/**
+ * @brief - Start worker threads
+ * @param settings - Settings applied by every worker thread, before it takes first timer
+ */
+void TimersExecutor::start(const ThreadSettings& settings) {
+    std::lock_guard lockGuard{m_mutex};
+    if (!m_running) {
+        m_running = true;
+        for (size_t i = 0; i < m_threadsCount; ++i) {
+            m_workers.emplace_back([this, settings, i]() {
+                applyThreadSettings(settings, i);
+                work();
+            });
+        }
+    }
+}
+
+/**
+ * @brief - Stop worker threads, after all dispatched timers are executed
+ */
+void TimersExecutor::stop() {
+    {
+        std::lock_guard lockGuard{m_mutex};
+        m_running = false;
+    }
+    m_cond.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+}
+
+/**
+ * @brief - Hand over expired timers to workers
+ * @param timers - Expired timers, in order of dispatching
+ * @param owner - Index of dispatching shard, passed to completion handler
+ */
+void TimersExecutor::dispatch(std::vector<std::shared_ptr<Timer>>& timers, size_t owner) {
+    {
+        std::lock_guard lockGuard{m_mutex};
+        for (auto& timer : timers) {
+            auto priority = timer->getPriority();
+            m_tasks.push(Task{priority, m_sequence++, std::move(timer), owner});
+        }
+    }
+    if (timers.size() == 1) {
+        m_cond.notify_one();
+    } else {
+        m_cond.notify_all();
+    }
+}
+
+/**
+ * @brief - Worker thread loop
+ */
+void TimersExecutor::work() {
+    while (true) {
+        std::shared_ptr<Timer> timer{};
+        size_t owner{};
+        {
+            std::unique_lock lock{m_mutex};
+            m_cond.wait(lock, [this]() { return !m_running || !m_tasks.empty(); });
+            if (m_tasks.empty()) {
+                break;
+            }
+            timer = m_tasks.top().timer;
+            owner = m_tasks.top().owner;
+            m_tasks.pop();
+        }
+
+        auto callbackAction = timer->fire();
+        if (m_completionHandler) {
+            m_completionHandler(std::move(timer), callbackAction, owner);
+        }
+    }
+}
+
+} // namespace Timers
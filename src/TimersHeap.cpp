@@ -0,0 +1,129 @@
+#include "Internal/TimersHeap.hpp"
+#include <algorithm>
+
+namespace Timers {
+
+/**
+ * @brief - Heap storage constructor
+ * @param resource - Memory resource from which heap nodes are allocated
+ */
+TimersHeap::TimersHeap(std::pmr::memory_resource* resource) : m_nodes{resource}, m_pending{resource} {}
+
+/**
+ * @brief - Add timer to storage, timer must not be registered yet
+ * @param timer - Timer to add
+ */
+void TimersHeap::insert(std::shared_ptr<Timer> timer) {
+    auto expirationTimePoint = timer->getLatestExpirationTimePoint();
+    m_nodes.push(Node{expirationTimePoint, std::move(timer)});
+}
+
+/**
+ * @brief - Add batch of timers to storage, timers which are already stored are skipped
+ * @details - Batch is appended and ordered once, large batch rebuilds whole heap in linear time
+ * @param timers - Timers to add
+ * @return - Number of added timers
+ */
+size_t TimersHeap::insertBatch(std::span<const std::shared_ptr<Timer>> timers) {
+    auto firstAppended = m_nodes.size();
+    m_nodes.reserve(firstAppended + timers.size());
+    for (const auto& timer : timers) {
+        // Appended timer already knows its index, so timer listed twice in batch is appended once
+        if (!contains(timer)) {
+            m_nodes.append(Node{timer->getLatestExpirationTimePoint(), timer});
+        }
+    }
+    m_nodes.restore(firstAppended);
+    return m_nodes.size() - firstAppended;
+}
+
+/**
+ * @brief - Remove timer from storage
+ * @param timer - Timer to remove
+ * @return - true if timer was removed, false if it was not registered
+ */
+bool TimersHeap::erase(const std::shared_ptr<Timer>& timer) {
+    if (!contains(timer)) {
+        return false;
+    }
+    m_nodes.erase(positionOf(*timer).index);
+    return true;
+}
+
+/**
+ * @brief - Remove all timers matching predicate
+ * @param predicate - Predicate selecting timers to remove
+ * @return - Number of removed timers
+ */
+size_t TimersHeap::eraseIf(bool (*predicate)(Timer&)) {
+    return m_nodes.eraseIf([predicate](Node& node) { return predicate(*node.timer); });
+}
+
+/**
+ * @brief - Check if timer is stored
+ * @param timer - Timer to check
+ * @return - true if timer is stored, false otherwise
+ */
+bool TimersHeap::contains(const std::shared_ptr<Timer>& timer) const {
+    auto index = positionOf(*timer).index;
+    return index < m_nodes.size() && m_nodes[index].timer == timer;
+}
+
+/**
+ * @brief - Get number of stored timers
+ * @return - number of timers
+ */
+size_t TimersHeap::size() const { return m_nodes.size(); }
+
+/**
+ * @brief - Get closest expiration time point of stored timers
+ * @return - Closest expiration time point, std::nullopt if storage is empty
+ */
+std::optional<Clock::time_point> TimersHeap::nextExpirationTimePoint() {
+    std::optional<Clock::time_point> nextExpiration{std::nullopt};
+    if (!m_nodes.empty()) {
+        nextExpiration = m_nodes.top().expirationTimePoint;
+    }
+    return nextExpiration;
+}
+
+/**
+ * @brief - Append all timers expiring exactly at specified time point
+ * @details - Only subtrees which root does not expire after time point are visited
+ * @param timePoint - Time point
+ * @param expiredTimers - Output list
+ */
+void TimersHeap::collectExpiringAt(Clock::time_point timePoint, std::pmr::list<std::shared_ptr<Timer>>& expiredTimers) {
+    m_pending.clear();
+    if (!m_nodes.empty()) {
+        m_pending.push_back(0);
+    }
+    while (!m_pending.empty()) {
+        auto index = m_pending.back();
+        m_pending.pop_back();
+        if (timePoint < m_nodes[index].expirationTimePoint) {
+            continue;
+        }
+        if (m_nodes[index].expirationTimePoint == timePoint) {
+            expiredTimers.emplace_back(m_nodes[index].timer);
+        }
+        auto firstChild = index * ARITY + 1;
+        auto lastChild = std::min(firstChild + ARITY, m_nodes.size());
+        for (auto child = firstChild; child < lastChild; ++child) {
+            m_pending.push_back(child);
+        }
+    }
+}
+
+/**
+ * @brief - Remove all timers expiring not later than specified time point, appending them to output vector
+ * @param timePoint - Time point
+ * @param expiredTimers - Output vector
+ */
+void TimersHeap::extractExpired(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) {
+    while (!m_nodes.empty() && !(timePoint < m_nodes.top().expirationTimePoint)) {
+        expiredTimers.emplace_back(m_nodes.pop().timer);
+    }
+}
+
+} // namespace Timers
@@ -1,49 +1,93 @@
 #include "Internal/TimersImplementation.hpp"
+#include <algorithm>
+#include "Internal/TimersLogger.hpp"
 #include "Internal/TimersManager.hpp"
 
 namespace Timers {
 
+std::atomic<uint64_t> Timer::cancellations{};
+std::atomic<uint64_t> Timer::totalOverruns{};
+
 /**
- * @brief - Timer interface constructor
- * @param callback - Callback function called on timer expiration
+ * @brief - Restart timer with current time point
  */
-Timer::Timer(std::function<void()> callback) : callback{std::move(callback)} {}
+void Timer::restart() noexcept { this->startTimePoint = Clock::now(); }
 
 /**
- * @brief - Timer interface constructor
- * @param callback - Callback function called on timer expiration
- * @param duration - Duration of timer ticking
+ * @brief - Get time point in which timer will expire
+ * @return - Expiration time point
  */
-Timer::Timer(std::function<void()> callback, std::chrono::high_resolution_clock::duration duration)
-    : callback{std::move(callback)}, duration{duration} {}
+Clock::time_point Timer::getExpirationTimePoint() const { return this->startTimePoint + this->duration; }
 
 /**
- * @brief - Timer interface constructor
- * @param callback - Callback function called on timer expiration
- * @param expirationTime - Point in time in which timer should expire
+ * @brief - Get latest time point in which timer has to be executed, expiration time point delayed by slack
+ * @return - Latest expiration time point
  */
-Timer::Timer(std::function<void()> callback, std::chrono::high_resolution_clock::time_point expirationTime)
-    : callback{std::move(callback)} {
-    this->startTimePoint = std::chrono::high_resolution_clock::now();
-    this->duration = expirationTime - this->startTimePoint;
+Clock::time_point Timer::getLatestExpirationTimePoint() const {
+    return getExpirationTimePoint() + getSlack();
 }
 
 /**
- * @brief - Restart timer with current time point
+ * @brief - Set delay after expiration time point, which timer tolerates
+ * @param slack - Tolerated delay
  */
-void Timer::restart() noexcept { this->startTimePoint = std::chrono::high_resolution_clock::now(); }
+void Timer::setSlack(Clock::duration slack) {
+    this->slack = std::max(slack, Clock::duration::zero());
+}
 
 /**
- * @brief - Get time point in which timer will expire
- * @return - Expiration time point
+ * @brief - Get delay after expiration time point, which timer tolerates
+ * @return - Tolerated delay, zero if it was not set
  */
-std::chrono::high_resolution_clock::time_point Timer::getExpirationTimePoint() const { return this->startTimePoint + this->duration; }
+Clock::duration Timer::getSlack() const {
+    return this->slack.value_or(Clock::duration::zero());
+}
 
 /**
- * @brief - set callback function
- * @param callback - Callback function called on timer expiration
+ * @brief - Set longest expected duration of callback's execution, longer executions are reported as overruns
+ * @param budget - Execution budget, zero disables measurement of this timer
  */
-void Timer::setCallback(std::function<void()> callback) { this->callback = std::move(callback); }
+void Timer::setExecutionBudget(Clock::duration budget) {
+    this->executionBudget = std::max(budget, Clock::duration::zero());
+}
+
+/**
+ * @brief - Get longest expected duration of callback's execution
+ * @return - Execution budget, zero if it was not set
+ */
+Clock::duration Timer::getExecutionBudget() const {
+    return this->executionBudget.value_or(Clock::duration::zero());
+}
+
+/**
+ * @brief - Get number of executions of this timer, which exceeded its execution budget
+ */
+uint32_t Timer::getOverruns() const noexcept { return this->overruns.load(std::memory_order_relaxed); }
+
+/**
+ * @brief - Get number of executions of all timers, which exceeded their execution budget
+ */
+uint64_t Timer::getTotalOverruns() noexcept { return totalOverruns.load(std::memory_order_relaxed); }
+
+/**
+ * @brief - Report execution, which exceeded execution budget
+ * @param executionTime - Duration of callback's execution
+ */
+void Timer::reportOverrun(Clock::duration executionTime) noexcept {
+    this->overruns.fetch_add(1, std::memory_order_relaxed);
+    totalOverruns.fetch_add(1, std::memory_order_relaxed);
+    if constexpr (Logger::isCompiledIn(Logger::Level::Warning)) {
+        try {
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            auto message = "Timer " + std::to_string(reinterpret_cast<uintptr_t>(this)) + " callback took " +
+                           std::to_string(duration_cast<microseconds>(executionTime).count()) + " us, over its budget of " +
+                           std::to_string(duration_cast<microseconds>(getExecutionBudget()).count()) + " us";
+            Logger::log<Logger::Level::Warning>(message);
+        } catch (...) {
+        }
+    }
+}
 
 /**
  * @brief - Set new priority of timer
@@ -61,30 +105,142 @@ uint32_t Timer::getPriority() const { return this->priority; }
  * @brief - Set new expiration time point of timer
  * @param timePoint - new expiration time point
  */
-void Timer::setExpirationTimePoint(std::chrono::high_resolution_clock::time_point expirationTimePoint) {
+void Timer::setExpirationTimePoint(Clock::time_point expirationTimePoint) {
     this->duration = expirationTimePoint - startTimePoint;
 }
 
 /**
- * @brief - Set timer running variable
+ * @brief - Lazily move expiration of started timer to later time point, without any action on timers thread
+ * @param expirationTimePoint - New expiration time point, ignored if it is not later than current one
+ */
+void Timer::extendTo(Clock::time_point expirationTimePoint) noexcept {
+    auto requested = expirationTimePoint.time_since_epoch().count();
+    auto current = this->extendedExpiration.load(std::memory_order_relaxed);
+    // Concurrent extensions never move already requested extension earlier
+    while (current < requested && !this->extendedExpiration.compare_exchange_weak(current, requested, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief - Lazily move expiration of started timer to one duration from now, typical for idle timeouts
+ */
+void Timer::extend() noexcept { extendTo(Clock::now() + this->duration); }
+
+/**
+ * @brief - Lazily cancel started timer, without any action on timers thread
+ */
+void Timer::cancel() noexcept {
+    if (!this->cancelled.exchange(true, std::memory_order_relaxed)) {
+        cancellations.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief - Check if timer was lazily cancelled
+ */
+bool Timer::isCancelled() const noexcept { return this->cancelled.load(std::memory_order_relaxed); }
+
+/**
+ * @brief - Clear tombstone and requested extension, before timer is started again
+ */
+void Timer::revive() noexcept {
+    this->cancelled.store(false, std::memory_order_relaxed);
+    this->extendedExpiration.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief - Release timer discarded at its tombstone, timer started by start() or startAsync() becomes idle
+ */
+void Timer::discard() noexcept { settle(ARMED, IDLE); }
+
+/**
+ * @brief - Send action starting timer, which was moved to PENDING_START
+ * @param previous - State from which timer was moved, lazily cancelled ARMED timer is restarted
+ */
+void Timer::requestStart(State previous) {
+    auto settleStart = [this](uint8_t, bool started) { settle(PENDING_START, started ? ARMED : IDLE); };
+    try {
+        if (previous == IDLE) {
+            TimersManager::addTimer(shared_from_this(), settleStart);
+        } else {
+            // Timer may still be registered with its tombstone, or be discarded meanwhile, restart covers both
+            TimersManager::restartTimer(shared_from_this(), settleStart);
+        }
+    } catch (...) {
+        settle(PENDING_START, previous);
+        throw;
+    }
+}
+
+/**
+ * @brief - Move timer from expected state to new one, and wake up threads waiting for it
+ * @return - true if timer was in expected state
  */
-void Timer::setRunningState(const bool& newState) { this->running = newState; }
+bool Timer::settle(State expected, State newState) noexcept {
+    if (this->state.compare_exchange_strong(expected, newState, std::memory_order_acq_rel)) {
+        this->state.notify_all();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief - Wait until timer leaves state
+ * @return - New state of timer
+ */
+Timer::State Timer::waitWhile(State current) const noexcept {
+    this->state.wait(current, std::memory_order_acquire);
+    return this->state.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief - Execute timer's callback, and keep state of started timer
+ * @return - Code returned by callback
+ */
+Timer::CallbackAction Timer::fire() {
+    auto expected = ARMED;
+    auto started = this->state.compare_exchange_strong(expected, FIRING, std::memory_order_acq_rel);
+    // Clock is read around callback only for timers with budget, coroutine nodes never have one
+    auto budget = getExecutionBudget();
+    auto measured = budget != Clock::duration::zero();
+    Clock::time_point executionStart{};
+    if (measured) {
+        executionStart = Clock::now();
+    }
+    auto callbackAction = run();
+    if (measured) {
+        auto executionTime = Clock::now() - executionStart;
+        if (executionTime > budget) {
+            reportOverrun(executionTime);
+        }
+    }
+    if (started) {
+        // Stop requested meanwhile is finished by its own action
+        settle(FIRING, callbackAction == CallbackAction::DELETE ? IDLE : ARMED);
+    }
+    return callbackAction;
+}
 
 /**
  * @brief - Send add action to timer's thread, and wait until it's started
  */
 void Timer::start() {
-    if (this->running) {
-        return;
-    } else {
-        std::promise<int> returnCode{};
-        auto future = returnCode.get_future();
-        auto timerReadyCallback = [this, &returnCode](int retCode, bool newRunningState) {
-            returnCode.set_value(retCode);
-            this->setRunningState(newRunningState);
-        };
-        TimersManager::addTimer(shared_from_this(), timerReadyCallback);
-        future.get();
+    auto current = this->state.load(std::memory_order_acquire);
+    while (true) {
+        if (current == IDLE || (current == ARMED && isCancelled())) {
+            auto previous = current;
+            // Failed exchange means other thread started timer, or timers thread discarded it meanwhile
+            if (this->state.compare_exchange_strong(current, PENDING_START, std::memory_order_acq_rel)) {
+                requestStart(previous);
+                waitWhile(PENDING_START);
+                return;
+            }
+            continue;
+        }
+        if (current != PENDING_START) {
+            return;
+        }
+        current = waitWhile(current);
     }
 }
 
@@ -92,53 +248,54 @@ void Timer::start() {
  * @brief - Send add action to timer's thread, and continue execution
  */
 void Timer::startAsync() {
-    if (this->running) {
-        return;
-    } else {
-        TimersManager::addTimer(shared_from_this(), nullptr);
+    auto current = this->state.load(std::memory_order_acquire);
+    while (current == IDLE || (current == ARMED && isCancelled())) {
+        auto previous = current;
+        if (this->state.compare_exchange_strong(current, PENDING_START, std::memory_order_acq_rel)) {
+            requestStart(previous);
+            return;
+        }
     }
 }
 
 /**
- * @brief - Send stop action to timer's thread
+ * @brief - Send stop action to timer's thread, and wait until it's stopped
+ * @details - Only one of concurrent stoppers sends action, the others wait for it on the same futex
  */
 void Timer::stop() {
-    if (!this->running) {
-        return;
-    } else {
-        TimersManager::eraseTimer(shared_from_this());
-        while (this->running) {
-            std::this_thread::yield();
+    auto current = this->state.load(std::memory_order_acquire);
+    while (current != IDLE) {
+        if (current == ARMED || current == FIRING) {
+            if (this->state.compare_exchange_weak(current, PENDING_STOP, std::memory_order_acq_rel)) {
+                try {
+                    TimersManager::eraseTimer(shared_from_this(), [this](uint8_t, bool) { settle(PENDING_STOP, IDLE); });
+                } catch (...) {
+                    settle(PENDING_STOP, IDLE);
+                    throw;
+                }
+                current = PENDING_STOP;
+            }
+            continue;
         }
+        // Pending start is finished before stop, so stop action is queued after start action
+        current = waitWhile(current);
     }
 }
 
 /**
- * @brief - Get duration
- */
-std::chrono::high_resolution_clock::duration Timer::getDuration() const { return this->duration; }
-
-/**
- * @brief - One shot timer constructor
- * @param callback - Callback function called on timer expiration
+ * @brief - Get state of timer started by start() or startAsync()
  */
-OneShotTimer::OneShotTimer(std::function<void()> callback) : Timer(std::move(callback)) {}
+Timer::State Timer::getState() const noexcept { return this->state.load(std::memory_order_acquire); }
 
 /**
- * @brief - One shot timer constructor
- * @param callback - Callback function called on timer expiration
- * @param duration - Duration of timer ticking
+ * @brief - Check if timer is started, or its start is pending
  */
-OneShotTimer::OneShotTimer(std::function<void()> callback, std::chrono::high_resolution_clock::duration duration)
-    : Timer(std::move(callback), duration) {}
+bool Timer::isRunning() const noexcept { return getState() != IDLE; }
 
 /**
- * @brief - One shot timer constructor
- * @param callback - Callback function called on timer expiration
- * @param expirationTime - Point in time in which timer should expire
+ * @brief - Get duration
  */
-OneShotTimer::OneShotTimer(std::function<void()> callback, std::chrono::high_resolution_clock::time_point expirationTime)
-    : Timer(std::move(callback), expirationTime) {}
+Clock::duration Timer::getDuration() const { return this->duration; }
 
 /**
  * @brief - Executes callback function
@@ -148,45 +305,87 @@ Timer::CallbackAction OneShotTimer::run() {
     if (this->callback) {
         this->callback();
     } else {
-        std::cout << "Timer callback function is not provided" << std::endl;
+        Logger::log<Logger::Level::Warning>("Timer callback function is not provided");
     }
     return CallbackAction::DELETE;
 }
 
 /**
- * @brief - Repeatable timer constructor
- * @param callback - Callback function called on timer expiration
- */
-RepeatableTimer::RepeatableTimer(std::function<void()> callback) : Timer(std::move(callback)) {}
-
-/**
- * @brief - Repeatable timer constructor
- * @param callback - Callback function called on timer expiration
- * @param duration - Duration of timer ticking
+ * @brief - Move start time point to begin of next period, according to schedule mode and catch up policy
+ * @return - Number of periods covered by current execution
  */
-RepeatableTimer::RepeatableTimer(std::function<void()> callback, std::chrono::high_resolution_clock::duration duration)
-    : Timer(std::move(callback), duration) {}
+uint32_t RepeatableTimer::schedule() {
+    auto period = this->duration.count();
+    auto startTicks = this->startTimePoint.time_since_epoch().count();
+    if (period <= 0) {
+        return 1;
+    }
+    // Start time point moved since last execution, so grid starts from it again
+    if (startTicks != anchorTicks + static_cast<Clock::rep>(periodIndex) * period) {
+        anchorTicks = startTicks;
+        periodIndex = 0;
+    }
 
-/**
- * @brief - Repeatable timer constructor
- * @param callback - Callback function called on timer expiration
- * @param expirationTime - Point in time in which timer should expire
- */
-RepeatableTimer::RepeatableTimer(std::function<void()> callback, std::chrono::high_resolution_clock::time_point expirationTime)
-    : Timer(std::move(callback), expirationTime) {}
+    uint64_t covered = 1;
+    auto lateness = this->firingTimePoint.time_since_epoch().count() - (startTicks + period);
+    if (lateness >= period && catchUpPolicy != BURST) {
+        // Whole periods which elapsed after current expiration, next expiration stays on grid in future
+        covered += static_cast<uint64_t>(lateness / period);
+    }
+    periodIndex += covered;
+    this->startTimePoint = Clock::time_point{Clock::duration{anchorTicks + static_cast<Clock::rep>(periodIndex) * period}};
+    return catchUpPolicy == COALESCE ? static_cast<uint32_t>(covered) : 1;
+}
 
 /**
- * @brief - Executes callback function
+ * @brief - Executes callback function, and moves expiration time point to next period
  * @return - Always return none code for repeatable timer
  */
 Timer::CallbackAction RepeatableTimer::run() {
-    expirationCount++;
+    if (scheduleMode == FIXED_RATE) {
+        // Next period is computed before callback, so callback may still restart or extend timer
+        lastCoalescedCount = schedule();
+    } else {
+        lastCoalescedCount = 1;
+    }
+    expirationCount += lastCoalescedCount;
     if (this->callback) {
         this->callback();
     }
+    if (scheduleMode == FIXED_DELAY) {
+        this->startTimePoint = Clock::now();
+    }
     return CallbackAction::NONE;
 }
 
 uint32_t RepeatableTimer::getExpirationsCount() const { return this->expirationCount; }
 
+/**
+ * @brief - Get number of periods covered by last execution, can be read from callback
+ * @return - One, or number of coalesced periods for COALESCE policy
+ */
+uint32_t RepeatableTimer::getLastCoalescedCount() const { return this->lastCoalescedCount; }
+
+/**
+ * @brief - Set how next expiration time point is scheduled, must not be changed while timer is running
+ * @param mode - Schedule mode
+ */
+void RepeatableTimer::setScheduleMode(ScheduleMode mode) noexcept { this->scheduleMode = mode; }
+
+/**
+ * @brief - Get how next expiration time point is scheduled
+ */
+RepeatableTimer::ScheduleMode RepeatableTimer::getScheduleMode() const { return this->scheduleMode; }
+
+/**
+ * @brief - Set what fixed rate timer does with missed periods, must not be changed while timer is running
+ * @param policy - Catch up policy
+ */
+void RepeatableTimer::setCatchUpPolicy(CatchUpPolicy policy) noexcept { this->catchUpPolicy = policy; }
+
+/**
+ * @brief - Get what fixed rate timer does with missed periods
+ */
+RepeatableTimer::CatchUpPolicy RepeatableTimer::getCatchUpPolicy() const { return this->catchUpPolicy; }
+
 } // namespace Timers
\ No newline at end of file
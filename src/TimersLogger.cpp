@@ -0,0 +1,23 @@
+#include "Internal/TimersLogger.hpp"
+
+namespace Timers {
+
+std::atomic<std::shared_ptr<Logger>> Logger::instance{};
+
+/**
+ * @brief - Set logger receiving diagnostics of whole library
+ * @param logger - Logger instance, nullptr drops diagnostics
+ */
+void Logger::setInstance(std::shared_ptr<Logger> logger) { instance.store(std::move(logger), std::memory_order_release); }
+
+/**
+ * @brief - Pass diagnostic to logger instance, if it is set
+ */
+void Logger::write(Level level, std::string_view message) noexcept {
+    // Logger is kept alive by local reference, even if it is replaced meanwhile
+    if (auto logger = instance.load(std::memory_order_acquire)) {
+        (*logger)(level, message);
+    }
+}
+
+} // namespace Timers
@@ -1,6 +1,10 @@
 #include "Internal/TimersManager.hpp"
 #include "Internal/TimersError.hpp"
+#include <algorithm>
 #include <utility>
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 namespace Timers {
 
@@ -14,14 +18,59 @@ TimersManager* TimersManager::instance = nullptr;
  */
 std::once_flag TimersManager::initInstanceFlag{};
 
+/**
+ * @brief - Constructor of TimersManager
+ * @param configuration - Configuration of manager
+ */
+TimersManager::TimersManager(const TimersConfiguration& configuration) : configuration{configuration} {
+    Clock::setSource(configuration.clockSource);
+    auto shardsCount = configuration.shardsCount != 0 ? configuration.shardsCount : std::thread::hardware_concurrency();
+    shardsCount = std::max<size_t>(shardsCount, 1);
+    for (size_t i = 0; i < shardsCount; ++i) {
+        shards.emplace_back(std::make_unique<TimersShard>(configuration.cacheBackend, configuration.actionsQueueCapacity, slab,
+                                                     configuration.waitBackend, configuration.waitMode,
+                                                     configuration.spinGuard, configuration.memoryResource));
+        if (configuration.collectStatistics) {
+            shards.back()->statistics = std::make_unique<TimersStatistics>();
+        }
+        shards.back()->timersCache.setCompactionInterval(configuration.compactionInterval);
+    }
+
+    auto completionHandler = [this](std::shared_ptr<Timer> timer, Timer::CallbackAction callbackAction, size_t shardIndex) {
+        completeExecution(std::move(timer), callbackAction, shardIndex);
+    };
+    if (configuration.dispatchMode == DispatchMode::EXECUTOR) {
+        executor = std::make_unique<TimersExecutor>(configuration.executorThreads, completionHandler);
+    }
+    if (configuration.bulkExecutorThreads > 0) {
+        bulkExecutor = std::make_unique<TimersExecutor>(configuration.bulkExecutorThreads, completionHandler);
+    }
+    if (configuration.slowLaneOverruns > 0) {
+        slowLaneExecutor = std::make_unique<TimersExecutor>(1, completionHandler);
+    }
+}
+
+/**
+ * @brief - Return executed timer to its shard
+ * @param timer - Timer executed by executor
+ * @param callbackAction - Code returned by timer's callback
+ * @param shardIndex - Index of shard which dispatched timer
+ */
+void TimersManager::completeExecution(std::shared_ptr<Timer> timer, Timer::CallbackAction callbackAction, size_t shardIndex) {
+    auto action = callbackAction == Timer::CallbackAction::NONE ? TIMER_ACTION::RESCHEDULE : TIMER_ACTION::RELEASE;
+    auto& shard = *shards[shardIndex];
+    shard.push(action, std::move(timer), nullptr);
+}
+
 /**
  * @brief - Initialize TimersManager Singlegon
+ * @param configuration - Configuration of manager
  */
-void TimersManager::initialize() {
+void TimersManager::initialize(const TimersConfiguration& configuration) {
     if (!instance) {
         std::call_once(initInstanceFlag, [&]() {
             try {
-                instance = new TimersManager();
+                instance = new TimersManager(configuration);
             } catch (std::bad_alloc& ex) {
                 throw TimersManagerInitializationError(std::string("Memory allocation error - ") + std::string(ex.what()));
             }
@@ -63,15 +112,34 @@ bool TimersManager::isRunning() {
 
 /**
  * @brief - Start's timers thread
+ * @param threadsConfiguration - Affinity, scheduling, names and stacks of started timers and worker threads
  */
-void TimersManager::start() {
+void TimersManager::start(const ThreadsConfiguration& threadsConfiguration) {
     if (isInitialized()) {
         TimersManager& timersManager = getInstance();
         if (!timersManager.isRunning()) {
             timersManager.threadsRunning = true;
-            timersManager.timersThread =
-                std::thread(TimersRunner(), std::ref(timersManager.threadsRunning), std::ref(timersManager.timersCache),
-                            std::ref(timersManager.m_threadControl), std::ref(timersManager.actionsQueue));
+            if (timersManager.executor) {
+                timersManager.executor->start(threadsConfiguration.executor);
+            }
+            if (timersManager.bulkExecutor) {
+                timersManager.bulkExecutor->start(threadsConfiguration.bulkExecutor);
+            }
+            if (timersManager.slowLaneExecutor) {
+                timersManager.slowLaneExecutor->start(threadsConfiguration.slowLaneExecutor);
+            }
+            const auto& configuration = timersManager.configuration;
+            for (size_t index = 0; index < timersManager.shards.size(); ++index) {
+                auto& shard = *timersManager.shards[index];
+                TimersRunner runner{timersManager.bulkExecutor.get(), configuration.bulkLaneThreshold,
+                                    timersManager.slowLaneExecutor.get(), configuration.slowLaneOverruns, index};
+                // Settings are applied before first action is taken, so timers never tick with inherited ones
+                shard.timersThread = std::thread([runner = std::move(runner), settings = threadsConfiguration.runner, index, &timersManager,
+                                                  &shard]() mutable {
+                    applyThreadSettings(settings, index);
+                    runner(timersManager.threadsRunning, shard, timersManager.executor.get());
+                });
+            }
         }
     } else {
         throw TimersManagerError("Timers manager is not initialized");
@@ -86,8 +154,19 @@ void TimersManager::stop() {
         TimersManager& timersManager = getInstance();
         if (timersManager.threadsRunning) {
             timersManager.threadsRunning = false;
-            timersManager.m_threadControl.cond.notify_one();
-            timersManager.timersThread.join();
+            for (auto& shard : timersManager.shards) {
+                shard->threadControl.notify();
+                shard->timersThread.join();
+            }
+            if (timersManager.executor) {
+                timersManager.executor->stop();
+            }
+            if (timersManager.bulkExecutor) {
+                timersManager.bulkExecutor->stop();
+            }
+            if (timersManager.slowLaneExecutor) {
+                timersManager.slowLaneExecutor->stop();
+            }
         }
     } else {
         throw TimersManagerError("Timers manager is not initialized");
@@ -98,11 +177,20 @@ void TimersManager::stop() {
  * @brief - Register new timer
  * @param timer - timer to register
  */
-void TimersManager::addTimer(std::shared_ptr<Timer> timer, std::function<void(uint8_t retCode, bool newRunningState)> callback) {
-    if (isInitialized()) {
+void TimersManager::addTimer(std::shared_ptr<Timer> timer, ActionCallback callback) {
+    if (!timer) {
+        throw TimerError("Timer is not initialized - nullptr");
+    } else if (isInitialized()) {
         TimersManager& timersManager = getInstance();
-        timersManager.actionsQueue.push(TIMER_ACTION::START, std::move(timer), std::move(callback));
-        timersManager.m_threadControl.cond.notify_one();
+        if (!timer->slack.has_value()) {
+            timer->slack = timersManager.configuration.timerSlack;
+        }
+        if (!timer->executionBudget.has_value()) {
+            timer->executionBudget = timersManager.configuration.executionBudget;
+        }
+        timer->revive();
+        auto& shard = *timersManager.shards[timersManager.shardOf(timer)];
+        shard.push(TIMER_ACTION::START, std::move(timer), std::move(callback));
     } else {
         throw TimersManagerError("Timers manager is not initialized");
     }
@@ -111,27 +199,315 @@ void TimersManager::addTimer(std::shared_ptr<Timer> timer, std::function<void(ui
 /**
  * @brief - Remove timer
  * @param timer - timer to erase
+ * @param callback - Function called from timers thread, after timer was removed
  */
-void TimersManager::eraseTimer(std::shared_ptr<Timer> timer) {
-    if (isInitialized()) {
+void TimersManager::eraseTimer(std::shared_ptr<Timer> timer, ActionCallback callback) {
+    if (!timer) {
+        throw TimerError("Timer is not initialized - nullptr");
+    } else if (isInitialized()) {
+        TimersManager& timersManager = getInstance();
+        auto& shard = *timersManager.shards[timersManager.shardOf(timer)];
+        shard.push(TIMER_ACTION::STOP, std::move(timer), std::move(callback));
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Restart timer, it expires after its duration from now. Lazily cancelled timer is started again
+ * @param timer - Timer to restart
+ * @param callback - Function called on timers thread, after timer was restarted
+ */
+void TimersManager::restartTimer(std::shared_ptr<Timer> timer, ActionCallback callback) {
+    if (!timer) {
+        throw TimerError("Timer is not initialized - nullptr");
+    } else if (isInitialized()) {
+        TimersManager& timersManager = getInstance();
+        auto& shard = *timersManager.shards[timersManager.shardOf(timer)];
+        shard.push(TIMER_ACTION::RESTART, std::move(timer), std::move(callback));
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Register batch of timers, with single action and single wake up of each involved timers thread
+ * @param timers - Timers to register
+ * @param callback - Function called once per involved shard, after its part of batch was registered
+ */
+void TimersManager::addTimers(std::span<const std::shared_ptr<Timer>> timers, ActionCallback callback) {
+    if (std::any_of(std::begin(timers), std::end(timers), [](const std::shared_ptr<Timer>& timer) { return !timer; })) {
+        throw TimerError("Timer is not initialized - nullptr");
+    } else if (isInitialized()) {
+        TimersManager& timersManager = getInstance();
+        std::vector<std::vector<std::shared_ptr<Timer>>> batches(timersManager.shards.size());
+        for (const auto& timer : timers) {
+            if (!timer->slack.has_value()) {
+                timer->slack = timersManager.configuration.timerSlack;
+            }
+            if (!timer->executionBudget.has_value()) {
+                timer->executionBudget = timersManager.configuration.executionBudget;
+            }
+            timer->revive();
+            batches[timersManager.shardOf(timer)].emplace_back(timer);
+        }
+        timersManager.pushBatches(TIMER_ACTION::START_BATCH, batches, std::move(callback));
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Remove batch of timers, with single action and single wake up of each involved timers thread
+ * @param timers - Timers to erase
+ */
+void TimersManager::eraseTimers(std::span<const std::shared_ptr<Timer>> timers) {
+    if (std::any_of(std::begin(timers), std::end(timers), [](const std::shared_ptr<Timer>& timer) { return !timer; })) {
+        throw TimerError("Timer is not initialized - nullptr");
+    } else if (isInitialized()) {
         TimersManager& timersManager = getInstance();
-        timersManager.actionsQueue.push(TIMER_ACTION::STOP, std::move(timer), nullptr);
-        timersManager.m_threadControl.cond.notify_one();
+        std::vector<std::vector<std::shared_ptr<Timer>>> batches(timersManager.shards.size());
+        for (const auto& timer : timers) {
+            batches[timersManager.shardOf(timer)].emplace_back(timer);
+        }
+        timersManager.pushBatches(TIMER_ACTION::STOP_BATCH, batches, nullptr);
     } else {
         throw TimersManagerError("Timers manager is not initialized");
     }
 }
 
 /**
- * @brief - Set logger instance
+ * @brief - Queue batch action on every shard, which has timers in batch
+ * @param action - Batch action
+ * @param batches - Timers of batch, split by shard index
+ * @param callback - Function called once per involved shard
+ */
+void TimersManager::pushBatches(TIMER_ACTION action, std::vector<std::vector<std::shared_ptr<Timer>>>& batches, ActionCallback callback) {
+    auto involvedShards = std::count_if(std::begin(batches), std::end(batches), [](const auto& batch) { return !batch.empty(); });
+    // Callback is move-only, so shards share it when batch is split
+    std::shared_ptr<ActionCallback> sharedCallback{};
+    if (callback && involvedShards > 1) {
+        sharedCallback = std::make_shared<ActionCallback>(std::move(callback));
+    }
+    for (size_t shardIndex = 0; shardIndex < batches.size(); ++shardIndex) {
+        if (batches[shardIndex].empty()) {
+            continue;
+        }
+        ActionCallback shardCallback{};
+        if (sharedCallback) {
+            shardCallback = [sharedCallback](uint8_t retCode, bool newRunningState) { (*sharedCallback)(retCode, newRunningState); };
+        } else {
+            shardCallback = std::move(callback);
+        }
+        shards[shardIndex]->push(action, std::move(batches[shardIndex]), std::move(shardCallback));
+    }
+}
+
+/**
+ * @brief - Set logger instance, receiving diagnostics of whole library
  */
 void TimersManager::setLogger(std::shared_ptr<Logger> logger) {
     if (isInitialized()) {
         TimersManager& timersManager = getInstance();
         timersManager.logger = logger;
+        Logger::setInstance(std::move(logger));
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Create timer addressed by handle, kept in compact record without reference counting
+ * @param callback - Function called on timer expiration, on timers thread
+ * @param context - Argument of callback
+ * @param interval - Duration of timer ticking, period of repeatable timer
+ * @param repeatable - Defines, if timer keeps ticking after expiration
+ * @return - Handle of created timer
+ */
+TimerId TimersManager::createTimer(TimerFunction callback, void* context, Clock::duration interval, bool repeatable) {
+    if (isInitialized()) {
+        return getInstance().slab.create(callback, context, interval, repeatable);
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Start timer addressed by handle, it expires after its interval from now. Started timer is restarted
+ * @param timerId - Handle of timer
+ */
+void TimersManager::startTimer(TimerId timerId) {
+    if (isInitialized()) {
+        TimersManager& timersManager = getInstance();
+        auto record = timersManager.slab.find(timerId);
+        if (!record) {
+            throw TimerError("Timer handle is stale");
+        }
+        auto expirationTimePoint = Clock::now() + record->interval;
+        timersManager.shardOf(timerId).push(TIMER_ACTION::START_HANDLE, timerId, expirationTimePoint);
     } else {
         throw TimersManagerError("Timers manager is not initialized");
     }
 }
 
+/**
+ * @brief - Stop timer addressed by handle
+ * @param timerId - Handle of timer
+ */
+void TimersManager::stopTimer(TimerId timerId) {
+    if (isInitialized()) {
+        TimersManager& timersManager = getInstance();
+        timersManager.shardOf(timerId).push(TIMER_ACTION::STOP_HANDLE, timerId, {});
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Stop and release timer addressed by handle, handle becomes stale
+ * @param timerId - Handle of timer
+ */
+void TimersManager::destroyTimer(TimerId timerId) {
+    if (isInitialized()) {
+        TimersManager& timersManager = getInstance();
+        timersManager.shardOf(timerId).push(TIMER_ACTION::DESTROY_HANDLE, timerId, {});
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Get shard of timer addressed by handle
+ * @param timerId - Handle of timer
+ * @return - Shard of timer
+ */
+TimersShard& TimersManager::shardOf(TimerId timerId) { return *shards[timerId.index() % shards.size()]; }
+
+/**
+ * @brief - Get number of shards, each having its own timers thread
+ * @return - number of shards
+ */
+size_t TimersManager::getShardsCount() {
+    if (isInitialized()) {
+        return getInstance().shards.size();
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Get descriptor, which becomes readable when timers thread of shard should wake up
+ * @param shardIndex - Index of shard
+ * @return - epoll descriptor, -1 if timers threads do not use TIMERFD wait backend
+ */
+int TimersManager::getWaitFd(size_t shardIndex) {
+    if (isInitialized()) {
+        auto& shards = getInstance().shards;
+        if (shardIndex >= shards.size()) {
+            throw TimersManagerError("Shard index out of range");
+        }
+        return shards[shardIndex]->threadControl.fd();
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Get number of timers threads wake ups, which were avoided by executing timers within their slack
+ * @return - Number of saved wake ups, summed over all shards
+ */
+uint64_t TimersManager::getSavedWakeUps() {
+    if (isInitialized()) {
+        uint64_t savedWakeUps{};
+        for (const auto& shard : getInstance().shards) {
+            savedWakeUps += shard->timersCache.getSavedWakeUps();
+        }
+        return savedWakeUps;
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Get number of timers callbacks, which exceeded their execution budget
+ * @return - Number of overruns, of all timers in process
+ */
+uint64_t TimersManager::getOverruns() {
+    if (isInitialized()) {
+        return Timer::getTotalOverruns();
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Get statistics of timers threads, without taking any of their locks
+ * @return - Statistics summed over all shards
+ */
+TimersStatisticsSnapshot TimersManager::getStatistics() {
+    if (isInitialized()) {
+        TimersStatisticsSnapshot statistics{};
+        for (const auto& shard : getInstance().shards) {
+            if (!shard->statistics) {
+                throw TimersManagerError("Statistics are not collected, enable them in configuration");
+            }
+            statistics.merge(shard->statistics->snapshot());
+        }
+        return statistics;
+    } else {
+        throw TimersManagerError("Timers manager is not initialized");
+    }
+}
+
+/**
+ * @brief - Get shard of timer, timer is assigned to shard on first call
+ * @param timer - Timer
+ * @return - Index of shard
+ */
+size_t TimersManager::shardOf(const std::shared_ptr<Timer>& timer) const {
+    auto shardIndex = timer->shardIndex.load(std::memory_order_acquire);
+    if (shardIndex == Timer::NO_SHARD) {
+        // Timer stays on its shard, so shard which checked it out is also the one to which it is returned
+        auto selected = selectShard(timer);
+        if (timer->shardIndex.compare_exchange_strong(shardIndex, selected, std::memory_order_acq_rel)) {
+            shardIndex = selected;
+        }
+    }
+    return shardIndex;
+}
+
+/**
+ * @brief - Select shard for timer which is being started
+ * @param timer - Timer to start
+ * @return - Index of shard
+ */
+size_t TimersManager::selectShard(const std::shared_ptr<Timer>& timer) const {
+    if (shards.size() == 1) {
+        return 0;
+    }
+
+    size_t hash{};
+    switch (configuration.shardingPolicy) {
+    case ShardingPolicy::THREAD_AFFINITY: {
+#ifdef __linux__
+        auto cpu = sched_getcpu();
+        if (cpu >= 0) {
+            return static_cast<size_t>(cpu) % shards.size();
+        }
+#endif
+        hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        break;
+    }
+    case ShardingPolicy::HASH:
+    default:
+        hash = std::hash<Timer*>{}(timer.get());
+        break;
+    }
+    // Timers are allocated with similar alignment, mix bits so low ones are not always equal
+    hash ^= hash >> 17;
+    hash *= 0xed5ad4bbU;
+    hash ^= hash >> 11;
+    return hash % shards.size();
+}
+
 } // namespace Timers
@@ -0,0 +1,194 @@
+#include "Internal/TimersSlab.hpp"
+#include "Internal/TimersError.hpp"
+
+namespace Timers {
+
+static_assert(sizeof(TimerRecord) <= 40, "Timer record is expected to stay compact");
+
+TimersSlab::TimersSlab() : m_chunks{std::make_unique<std::atomic<TimerRecord*>[]>(MAX_CHUNKS)} {}
+
+TimersSlab::~TimersSlab() {
+    for (size_t i = 0; i < m_chunksCount; ++i) {
+        delete[] m_chunks[i].load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief - Create timer record
+ * @param callback - Function called on timer expiration
+ * @param context - Argument of callback
+ * @param interval - Duration of timer ticking, period of repeatable timer
+ * @param repeatable - Defines, if timer keeps ticking after expiration
+ * @return - Handle of created timer
+ */
+TimerId TimersSlab::create(TimerFunction callback, void* context, Clock::duration interval, bool repeatable) {
+    if (repeatable && interval <= Clock::duration::zero()) {
+        throw TimerError("Repeatable timer requires positive interval");
+    }
+
+    std::lock_guard lockGuard{m_mutex};
+    uint32_t index{};
+    if (m_freeList != TimerRecord::NO_LINK) {
+        index = m_freeList;
+        m_freeList = at(index).link;
+    } else {
+        if (m_nextUnused / CHUNK_SIZE >= m_chunksCount) {
+            if (m_chunksCount == MAX_CHUNKS) {
+                throw TimerError("Timers slab is full");
+            }
+            m_chunks[m_chunksCount].store(new TimerRecord[CHUNK_SIZE], std::memory_order_release);
+            ++m_chunksCount;
+        }
+        index = m_nextUnused++;
+    }
+
+    auto& record = at(index);
+    record.interval = interval;
+    record.callback = callback;
+    record.context = context;
+    record.repeatable = repeatable;
+    record.link = TimerRecord::NO_LINK;
+    auto generation = record.generation.load(std::memory_order_relaxed) + 1;
+    record.generation.store(generation, std::memory_order_release);
+    ++m_size;
+    return TimerId{index, generation};
+}
+
+/**
+ * @brief - Release timer record, record must not be armed
+ * @return - false if handle was stale
+ */
+bool TimersSlab::destroy(TimerId timerId) {
+    std::lock_guard lockGuard{m_mutex};
+    auto record = find(timerId);
+    if (!record) {
+        return false;
+    }
+    record->generation.store(timerId.generation() + 1, std::memory_order_release);
+    record->callback = nullptr;
+    record->context = nullptr;
+    record->link = m_freeList;
+    m_freeList = timerId.index();
+    --m_size;
+    return true;
+}
+
+/**
+ * @brief - Get record referred by handle
+ * @return - Record, nullptr if handle is stale
+ */
+TimerRecord* TimersSlab::find(TimerId timerId) const {
+    if (!timerId.isValid() || timerId.index() / CHUNK_SIZE >= MAX_CHUNKS) {
+        return nullptr;
+    }
+    auto chunk = m_chunks[timerId.index() / CHUNK_SIZE].load(std::memory_order_acquire);
+    if (!chunk) {
+        return nullptr;
+    }
+    auto& record = chunk[timerId.index() % CHUNK_SIZE];
+    return record.generation.load(std::memory_order_acquire) == timerId.generation() ? &record : nullptr;
+}
+
+/**
+ * @brief - Get record at index, index must refer to created record
+ */
+TimerRecord& TimersSlab::at(uint32_t index) const {
+    return m_chunks[index / CHUNK_SIZE].load(std::memory_order_acquire)[index % CHUNK_SIZE];
+}
+
+/**
+ * @brief - Get number of records in use
+ */
+size_t TimersSlab::size() {
+    std::lock_guard lockGuard{m_mutex};
+    return m_size;
+}
+
+SlabSchedule::SlabSchedule(TimersSlab& slab) : m_slab{slab}, m_heap{EntryPosition{&slab}} {}
+
+/**
+ * @brief - Arm timer to expire at time point, armed timer is moved
+ * @return - false if handle was stale
+ */
+bool SlabSchedule::arm(TimerId timerId, Clock::time_point expirationTimePoint) {
+    auto record = m_slab.find(timerId);
+    if (!record) {
+        return false;
+    }
+    if (record->link != TimerRecord::NO_LINK) {
+        m_heap.rekey(record->link, expirationTimePoint);
+    } else {
+        m_heap.push(Entry{expirationTimePoint, timerId.index()});
+    }
+    return true;
+}
+
+/**
+ * @brief - Disarm timer
+ * @return - false if handle was stale or timer was not armed
+ */
+bool SlabSchedule::disarm(TimerId timerId) {
+    auto record = m_slab.find(timerId);
+    if (!record || record->link == TimerRecord::NO_LINK) {
+        return false;
+    }
+    m_heap.erase(record->link);
+    record->link = TimerRecord::NO_LINK;
+    return true;
+}
+
+/**
+ * @brief - Disarm timer and release its record
+ * @return - false if handle was stale
+ */
+bool SlabSchedule::destroy(TimerId timerId) {
+    disarm(timerId);
+    return m_slab.destroy(timerId);
+}
+
+/**
+ * @brief - Get number of armed timers
+ */
+size_t SlabSchedule::size() const { return m_heap.size(); }
+
+/**
+ * @brief - Get closest expiration time point of armed timers
+ */
+std::optional<Clock::time_point> SlabSchedule::nextExpirationTimePoint() const {
+    std::optional<Clock::time_point> nextExpiration{std::nullopt};
+    if (!m_heap.empty()) {
+        nextExpiration = m_heap.top().expirationTimePoint;
+    }
+    return nextExpiration;
+}
+
+/**
+ * @brief - Execute callbacks of all timers expired until time point, repeatable timers are armed for next period
+ * @param timePoint - Current time point
+ * @param statistics - Statistics recording firing lateness, nullptr if they are not collected
+ * @return - Number of executed callbacks
+ */
+size_t SlabSchedule::expire(Clock::time_point timePoint, TimersStatistics* statistics) {
+    size_t executed{};
+    while (!m_heap.empty() && !(timePoint < m_heap.top().expirationTimePoint)) {
+        const auto& entry = m_heap.top();
+        auto& record = m_slab.at(entry.index);
+        if (statistics) {
+            statistics->recordLateness(timePoint - entry.expirationTimePoint);
+        }
+        if (record.repeatable) {
+            // Next period is counted from passed expiration, so timer does not drift by callback execution time
+            m_heap.rekey(0, entry.expirationTimePoint + record.interval);
+        } else {
+            m_heap.pop();
+            record.link = TimerRecord::NO_LINK;
+        }
+        if (record.callback) {
+            record.callback(record.context);
+        }
+        ++executed;
+    }
+    return executed;
+}
+
+} // namespace Timers
@@ -0,0 +1,115 @@
+#include "Internal/TimersStatistics.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Timers {
+
+/**
+ * @brief - Get bucket counting value
+ * @param nanoseconds - Recorded value
+ * @return - Index of bucket
+ */
+size_t LatenessHistogram::bucketOf(uint64_t nanoseconds) noexcept {
+    if (nanoseconds < SUB_BUCKETS) {
+        return static_cast<size_t>(nanoseconds);
+    }
+    auto exponent = static_cast<size_t>(std::bit_width(nanoseconds)) - 1;
+    auto subBucket = static_cast<size_t>(nanoseconds >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return SUB_BUCKETS + (exponent - SUB_BUCKET_BITS) * SUB_BUCKETS + subBucket;
+}
+
+/**
+ * @brief - Get smallest value counted by bucket
+ * @param bucket - Index of bucket
+ * @return - Lower bound of bucket, in nanoseconds
+ */
+uint64_t LatenessHistogram::lowerBoundOf(size_t bucket) noexcept {
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    auto exponent = (bucket - SUB_BUCKETS) / SUB_BUCKETS + SUB_BUCKET_BITS;
+    auto subBucket = (bucket - SUB_BUCKETS) % SUB_BUCKETS;
+    return static_cast<uint64_t>(SUB_BUCKETS + subBucket) << (exponent - SUB_BUCKET_BITS);
+}
+
+/**
+ * @brief - Add counts of histogram to output vector, which is resized to BUCKETS
+ * @param counts - Output vector
+ * @return - Largest recorded value, in nanoseconds
+ */
+uint64_t LatenessHistogram::collect(std::vector<uint64_t>& counts) const {
+    counts.resize(BUCKETS);
+    for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+        counts[bucket] += m_counts[bucket].load(std::memory_order_relaxed);
+    }
+    return m_max.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief - Get number of timers, of which firing lateness was recorded
+ */
+uint64_t TimersStatisticsSnapshot::latenessSamples() const {
+    uint64_t samples{};
+    for (auto count : latenessCounts) {
+        samples += count;
+    }
+    return samples;
+}
+
+/**
+ * @brief - Get firing lateness, which is not exceeded by fraction of timers
+ * @param fraction - Fraction of timers, from 0.0 to 1.0
+ * @return - Lower bound of bucket containing requested lateness, zero if nothing was recorded
+ */
+Clock::duration TimersStatisticsSnapshot::latenessPercentile(double fraction) const {
+    auto samples = latenessSamples();
+    if (samples == 0) {
+        return Clock::duration::zero();
+    }
+    auto rank = static_cast<uint64_t>(std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(samples)));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t counted{};
+    for (size_t bucket = 0; bucket < latenessCounts.size(); ++bucket) {
+        counted += latenessCounts[bucket];
+        if (counted >= rank) {
+            return Clock::duration{static_cast<Clock::rep>(LatenessHistogram::lowerBoundOf(bucket))};
+        }
+    }
+    return latenessMax;
+}
+
+/**
+ * @brief - Add statistics of another shard
+ * @param other - Statistics to add
+ */
+void TimersStatisticsSnapshot::merge(const TimersStatisticsSnapshot& other) {
+    productiveWakeUps += other.productiveWakeUps;
+    spuriousWakeUps += other.spuriousWakeUps;
+    callbacksExecuted += other.callbacksExecuted;
+    actionsProcessed += other.actionsProcessed;
+    actionsQueueHighWater = std::max(actionsQueueHighWater, other.actionsQueueHighWater);
+    cacheSize += other.cacheSize;
+    latenessCounts.resize(std::max(latenessCounts.size(), other.latenessCounts.size()));
+    for (size_t bucket = 0; bucket < other.latenessCounts.size(); ++bucket) {
+        latenessCounts[bucket] += other.latenessCounts[bucket];
+    }
+    latenessMax = std::max(latenessMax, other.latenessMax);
+}
+
+/**
+ * @brief - Copy current values of counters
+ */
+TimersStatisticsSnapshot TimersStatistics::snapshot() const {
+    TimersStatisticsSnapshot snapshot{};
+    snapshot.productiveWakeUps = m_productiveWakeUps.load(std::memory_order_relaxed);
+    snapshot.spuriousWakeUps = m_spuriousWakeUps.load(std::memory_order_relaxed);
+    snapshot.callbacksExecuted = m_callbacksExecuted.load(std::memory_order_relaxed);
+    snapshot.actionsProcessed = m_actionsProcessed.load(std::memory_order_relaxed);
+    snapshot.actionsQueueHighWater = m_actionsQueueHighWater.load(std::memory_order_relaxed);
+    snapshot.cacheSize = m_cacheSize.load(std::memory_order_relaxed);
+    snapshot.latenessMax = Clock::duration{static_cast<Clock::rep>(m_lateness.collect(snapshot.latenessCounts))};
+    return snapshot;
+}
+
+} // namespace Timers
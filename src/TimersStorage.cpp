@@ -0,0 +1,142 @@
+#include "Internal/TimersStorage.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+namespace Timers {
+
+/**
+ * @brief - Multimap storage constructor
+ * @param resource - Memory resource from which multimap nodes are allocated
+ */
+MultimapStorage::MultimapStorage(std::pmr::memory_resource* resource) : m_timers{resource}, m_batch{resource} {}
+
+/**
+ * @brief - Add timer to storage, timer must not be registered yet
+ * @param timer - Timer to add
+ */
+void MultimapStorage::insert(std::shared_ptr<Timer> timer) {
+    auto expirationTimePoint = timer->getLatestExpirationTimePoint();
+    m_timers.insert(std::make_pair(expirationTimePoint, std::move(timer)));
+}
+
+/**
+ * @brief - Add batch of timers to storage, timers which are already stored are skipped
+ * @details - Batch is sorted and each timer is inserted next to previous one, so runs of timers not interleaved
+ *            with stored ones are inserted in amortized constant time, instead of searching whole tree for every timer
+ * @param timers - Timers to add
+ * @return - Number of added timers
+ */
+size_t MultimapStorage::insertBatch(std::span<const std::shared_ptr<Timer>> timers) {
+    m_batch.clear();
+    for (const auto& timer : timers) {
+        if (!contains(timer)) {
+            m_batch.emplace_back(timer->getLatestExpirationTimePoint(), timer);
+        }
+    }
+    // Timers expiring together are ordered by address, so timer listed twice in batch is inserted once
+    std::sort(std::begin(m_batch), std::end(m_batch), [](const auto& first, const auto& second) {
+        if (first.first != second.first) {
+            return first.first < second.first;
+        }
+        return std::less<Timer*>{}(first.second.get(), second.second.get());
+    });
+    m_batch.erase(std::unique(std::begin(m_batch), std::end(m_batch),
+                              [](const auto& first, const auto& second) { return first.second == second.second; }),
+                  std::end(m_batch));
+
+    auto inserted = m_batch.size();
+    if (!m_batch.empty()) {
+        auto hint = m_timers.upper_bound(m_batch.front().first);
+        for (auto& [expirationTimePoint, timer] : m_batch) {
+            hint = std::next(m_timers.emplace_hint(hint, expirationTimePoint, std::move(timer)));
+        }
+    }
+    m_batch.clear();
+    return inserted;
+}
+
+/**
+ * @brief - Remove timer from storage
+ * @param timer - Timer to remove
+ * @return - true if timer was removed, false if it was not registered
+ */
+bool MultimapStorage::erase(const std::shared_ptr<Timer>& timer) {
+    auto range = this->m_timers.equal_range(timer->getLatestExpirationTimePoint());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == timer) {
+            m_timers.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief - Remove all timers matching predicate
+ * @param predicate - Predicate selecting timers to remove
+ * @return - Number of removed timers
+ */
+size_t MultimapStorage::eraseIf(bool (*predicate)(Timer&)) {
+    return std::erase_if(this->m_timers, [predicate](const auto& entry) { return predicate(*entry.second); });
+}
+
+/**
+ * @brief - Check if timer is stored
+ * @param timer - Timer to check
+ * @return - true if timer is stored, false otherwise
+ */
+bool MultimapStorage::contains(const std::shared_ptr<Timer>& timer) const {
+    auto range = this->m_timers.equal_range(timer->getLatestExpirationTimePoint());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == timer) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief - Get number of stored timers
+ * @return - number of timers
+ */
+size_t MultimapStorage::size() const { return this->m_timers.size(); }
+
+/**
+ * @brief - Get closest expiration time point of stored timers
+ * @return - Closest expiration time point, std::nullopt if storage is empty
+ */
+std::optional<Clock::time_point> MultimapStorage::nextExpirationTimePoint() {
+    std::optional<Clock::time_point> nextExpiration{std::nullopt};
+    if (!m_timers.empty()) {
+        nextExpiration = std::begin(this->m_timers)->first;
+    }
+    return nextExpiration;
+}
+
+/**
+ * @brief - Append all timers expiring exactly at specified time point
+ * @param timePoint - Time point
+ * @param expiredTimers - Output list
+ */
+void MultimapStorage::collectExpiringAt(Clock::time_point timePoint, std::pmr::list<std::shared_ptr<Timer>>& expiredTimers) {
+    auto range = this->m_timers.equal_range(timePoint);
+    for (auto it = range.first; it != range.second; ++it) {
+        expiredTimers.emplace_back(it->second);
+    }
+}
+
+/**
+ * @brief - Remove all timers expiring not later than specified time point, appending them to output vector
+ * @param timePoint - Time point
+ * @param expiredTimers - Output vector
+ */
+void MultimapStorage::extractExpired(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) {
+    auto end = this->m_timers.upper_bound(timePoint);
+    for (auto it = std::begin(this->m_timers); it != end; ++it) {
+        expiredTimers.emplace_back(std::move(it->second));
+    }
+    this->m_timers.erase(std::begin(this->m_timers), end);
+}
+
+} // namespace Timers
@@ -0,0 +1,163 @@
+#include "Internal/TimersThreadControl.hpp"
+#include "Internal/TimersError.hpp"
+#include "Internal/TimersLogger.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace Timers {
+
+#ifdef __linux__
+namespace {
+/**
+ * @brief - Clock of timer descriptor, the same which std::chrono::steady_clock reads
+ */
+constexpr clockid_t TIMER_CLOCK = CLOCK_MONOTONIC;
+
+[[noreturn]] void throwSystemError(const char* operation) {
+    throw TimersManagerError(std::string(operation) + " failure - " + std::strerror(errno));
+}
+} // namespace
+#endif
+
+/**
+ * @brief - Create thread control waiting with specified backend
+ * @param waitBackend - Mechanism on which timers thread sleeps
+ */
+ThreadControl::ThreadControl(WaitBackend waitBackend) : ThreadControl(waitBackend, WaitMode::SLEEP, {}) {}
+
+/**
+ * @brief - Create thread control waiting with specified backend and precision
+ * @param waitBackend - Mechanism on which timers thread sleeps
+ * @param waitMode - Precision of hitting expiration time point
+ * @param spinGuard - Interval before expiration time point, spent spinning in SPIN mode
+ */
+ThreadControl::ThreadControl(WaitBackend waitBackend, WaitMode waitMode, Clock::duration spinGuard)
+    : m_waitMode{waitMode}, m_spinGuard{spinGuard} {
+#ifdef __linux__
+    if (waitBackend == WaitBackend::TIMERFD) {
+        m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+        m_timerFd = timerfd_create(TIMER_CLOCK, TFD_NONBLOCK | TFD_CLOEXEC);
+        m_eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_epollFd < 0 || m_timerFd < 0 || m_eventFd < 0) {
+            closeDescriptors();
+            throwSystemError("Timers thread descriptors creation");
+        }
+        for (auto fd : {m_timerFd, m_eventFd}) {
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+                closeDescriptors();
+                throwSystemError("Timers thread epoll registration");
+            }
+        }
+    }
+#else
+    (void)waitBackend;
+#endif
+}
+
+ThreadControl::~ThreadControl() { closeDescriptors(); }
+
+/**
+ * @brief - Close descriptors of TIMERFD backend
+ */
+void ThreadControl::closeDescriptors() {
+#ifdef __linux__
+    for (auto fd : {m_epollFd, m_timerFd, m_eventFd}) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    m_epollFd = m_timerFd = m_eventFd = -1;
+#endif
+}
+
+/**
+ * @brief - Wake up timers thread
+ */
+void ThreadControl::notify() {
+#ifdef __linux__
+    if (m_eventFd >= 0) {
+        uint64_t increment{1};
+        // Counter only saturates, when it is not read for 2^64 notifications, so failure can be ignored
+        [[maybe_unused]] auto written = write(m_eventFd, &increment, sizeof(increment));
+        return;
+    }
+#endif
+    { std::lock_guard lockGuard{lock}; }
+    cond.notify_one();
+}
+
+/**
+ * @brief - Arm timer descriptor to expire at steady time point, or disarm it
+ * @details - Failure is only reported, as it happens on timers thread which has no one to catch exception
+ * @param timePoint - Expiration time point, std::nullopt disarms timer descriptor
+ * @return - true if timer descriptor was armed, false if failure was reported
+ */
+bool ThreadControl::armTimer(std::optional<std::chrono::steady_clock::time_point> timePoint) noexcept {
+#ifdef __linux__
+    if (timePoint == m_armedTimePoint) {
+        return true;
+    }
+    itimerspec timerSpec{};
+    if (timePoint.has_value()) {
+        auto sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint->time_since_epoch()).count();
+        // Zero would disarm timer descriptor, time points before epoch are already expired
+        sinceEpoch = std::max<decltype(sinceEpoch)>(sinceEpoch, 1);
+        timerSpec.it_value.tv_sec = static_cast<time_t>(sinceEpoch / 1000000000);
+        timerSpec.it_value.tv_nsec = static_cast<long>(sinceEpoch % 1000000000);
+    }
+    if (timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &timerSpec, nullptr) < 0) {
+        if constexpr (Logger::isCompiledIn(Logger::Level::Error)) {
+            try {
+                Logger::log<Logger::Level::Error>(std::string("Timer descriptor arming failure - ") + std::strerror(errno));
+            } catch (...) {
+            }
+        }
+        return false;
+    }
+    m_armedTimePoint = timePoint;
+#else
+    (void)timePoint;
+#endif
+    return true;
+}
+
+/**
+ * @brief - Sleep until timer descriptor expires or notification is sent, and consume both
+ * @param timeout - Longest sleep, std::nullopt waits for descriptors only
+ */
+void ThreadControl::sleep(std::optional<std::chrono::steady_clock::time_point> timeout) {
+#ifdef __linux__
+    int timeoutMs{-1};
+    if (timeout.has_value()) {
+        // Rounded up, so thread does not wake up before time point and spin on zero timeout
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*timeout - std::chrono::steady_clock::now()).count();
+        timeoutMs = static_cast<int>(std::clamp<decltype(remaining)>(remaining, 0, INT32_MAX));
+    }
+    epoll_event events[2]{};
+    auto eventsCount = epoll_wait(m_epollFd, events, 2, timeoutMs);
+    for (int i = 0; i < eventsCount; ++i) {
+        uint64_t value{};
+        // Both descriptors are non-blocking, reading resets their readiness
+        [[maybe_unused]] auto readBytes = read(events[i].data.fd, &value, sizeof(value));
+        if (events[i].data.fd == m_timerFd) {
+            m_armedTimePoint.reset();
+        }
+    }
+#else
+    (void)timeout;
+#endif
+}
+
+} // namespace Timers
@@ -0,0 +1,155 @@
+#include "Internal/TimersThreadSettings.hpp"
+#include "Internal/TimersLogger.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Timers {
+
+#ifdef __linux__
+namespace {
+/**
+ * @brief - Maximal length of thread name, without terminating null
+ */
+constexpr size_t THREAD_NAME_LENGTH = 15;
+/**
+ * @brief - Part of stack, which is never pre-faulted, left for frames called while pre-faulting and signal handlers
+ */
+constexpr size_t STACK_RESERVE = 64 * 1024;
+
+void reportFailure(const char* setting, int error) noexcept {
+    if constexpr (Logger::isCompiledIn(Logger::Level::Error)) {
+        try {
+            Logger::log<Logger::Level::Error>(std::string("Thread ") + setting + " failure - " + std::strerror(error));
+        } catch (...) {
+        }
+    }
+}
+
+bool setAffinity(const std::vector<size_t>& cpus) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (auto cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) {
+            reportFailure("affinity", EINVAL);
+            return false;
+        }
+        CPU_SET(cpu, &cpuSet);
+    }
+    if (auto error = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet); error != 0) {
+        reportFailure("affinity", error);
+        return false;
+    }
+    return true;
+}
+
+bool setScheduling(SchedulingPolicy policy, int priority) {
+    sched_param parameter{};
+    parameter.sched_priority = priority;
+    if (auto error = pthread_setschedparam(pthread_self(), policy == SchedulingPolicy::FIFO ? SCHED_FIFO : SCHED_RR, &parameter);
+        error != 0) {
+        reportFailure("scheduling policy", error);
+        return false;
+    }
+    return true;
+}
+
+bool setName(const std::string& name, size_t index) {
+    // Name is truncated rather than index, so threads sharing settings stay distinguishable
+    auto suffix = "-" + std::to_string(index);
+    auto threadName = name.substr(0, THREAD_NAME_LENGTH - std::min(suffix.size(), THREAD_NAME_LENGTH)) + suffix;
+    threadName.resize(std::min(threadName.size(), THREAD_NAME_LENGTH));
+    if (auto error = pthread_setname_np(pthread_self(), threadName.c_str()); error != 0) {
+        reportFailure("name", error);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief - Get number of stack bytes below current frame of calling thread, which may still be used
+ * @return - Free stack, std::nullopt if bounds of stack cannot be read
+ */
+std::optional<size_t> freeStack() {
+    pthread_attr_t attributes;
+    if (pthread_getattr_np(pthread_self(), &attributes) != 0) {
+        return std::nullopt;
+    }
+    void* stackAddress{nullptr};
+    size_t stackSize{};
+    auto error = pthread_attr_getstack(&attributes, &stackAddress, &stackSize);
+    pthread_attr_destroy(&attributes);
+    if (error != 0) {
+        return std::nullopt;
+    }
+    // Stack grows down, from its end towards lowest address
+    auto lowest = reinterpret_cast<uintptr_t>(stackAddress);
+    auto frame = reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+    return frame > lowest + STACK_RESERVE ? frame - lowest - STACK_RESERVE : 0;
+}
+
+/**
+ * @brief - Touch every page of stack below calling frame, and optionally lock them in memory
+ * @details - Stack is reserved with alloca, so pages are touched within frame of this function. Pages stay
+ *            mapped and locked after it returns, ready for frames of thread's loop. Request exceeding free stack
+ *            of thread is reported and skipped, as it would overflow stack
+ */
+[[gnu::noinline]] bool prefaultStack(size_t bytes, bool lock) {
+    if (auto available = freeStack(); !available.has_value() || bytes > *available) {
+        reportFailure("stack pre-fault", available.has_value() ? EINVAL : ENOTSUP);
+        return false;
+    }
+    auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto* stack = static_cast<volatile unsigned char*>(__builtin_alloca(bytes));
+    for (size_t offset = 0; offset < bytes; offset += pageSize) {
+        stack[offset] = 0;
+    }
+    stack[bytes - 1] = 0;
+    if (lock && mlock(const_cast<unsigned char*>(stack), bytes) != 0) {
+        reportFailure("stack lock", errno);
+        return false;
+    }
+    return true;
+}
+} // namespace
+#endif
+
+/**
+ * @brief - Apply settings to calling thread
+ * @param settings - Settings to apply
+ * @param index - Index of thread among threads sharing settings, appended to its name
+ * @return - true if all settings were applied, false if any of them was skipped
+ */
+bool applyThreadSettings(const ThreadSettings& settings, size_t index) {
+    auto applied{true};
+#ifdef __linux__
+    if (!settings.name.empty()) {
+        applied = setName(settings.name, index) && applied;
+    }
+    if (!settings.cpus.empty()) {
+        applied = setAffinity(settings.cpus) && applied;
+    }
+    if (settings.schedulingPolicy != SchedulingPolicy::OTHER) {
+        applied = setScheduling(settings.schedulingPolicy, settings.priority) && applied;
+    }
+    // Stack is pre-faulted last, so its pages are taken from memory node of processor on which thread is pinned
+    if (settings.stackPrefault > 0) {
+        applied = prefaultStack(settings.stackPrefault, settings.lockStack) && applied;
+    }
+#else
+    static_cast<void>(index);
+    applied = settings.name.empty() && settings.cpus.empty() && settings.schedulingPolicy == SchedulingPolicy::OTHER &&
+              settings.stackPrefault == 0;
+#endif
+    return applied;
+}
+
+} // namespace Timers
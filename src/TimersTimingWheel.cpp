@@ -0,0 +1,327 @@
+#include "Internal/TimersTimingWheel.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace Timers {
+
+/**
+ * @brief - Timing wheel constructor
+ * @param resolution - Duration of single tick of lowest level
+ * @param resource - Memory resource from which slots are allocated
+ */
+TimingWheel::TimingWheel(Clock::duration resolution, std::pmr::memory_resource* resource)
+    : m_resolution{resolution}, m_slots(OVERFLOW_SLOT + 1, resource) {}
+
+/**
+ * @brief - Convert time point to wheel tick
+ */
+uint64_t TimingWheel::toTick(Clock::time_point timePoint) const {
+    auto sinceEpoch = timePoint.time_since_epoch();
+    if (sinceEpoch.count() <= 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(sinceEpoch / m_resolution);
+}
+
+/**
+ * @brief - Get slot in which timer expiring at tick should be kept, regarding current wheel cursor
+ */
+size_t TimingWheel::slotOf(uint64_t tick) const {
+    tick = std::max(tick, m_currentTick);
+    uint64_t difference = tick ^ m_currentTick;
+    for (size_t level = 0; level < LEVELS; ++level) {
+        if ((difference >> (SLOT_BITS * (level + 1))) == 0) {
+            return level * SLOTS_PER_LEVEL + ((tick >> (SLOT_BITS * level)) & (SLOTS_PER_LEVEL - 1));
+        }
+    }
+    return OVERFLOW_SLOT;
+}
+
+/**
+ * @brief - Get first tick covered by slot, regarding current wheel cursor
+ */
+uint64_t TimingWheel::firstTickOf(size_t slot) const {
+    if (slot == OVERFLOW_SLOT) {
+        // Overflow slot only keeps timers beyond highest level, which starts with next highest level block
+        return ((m_currentTick >> (SLOT_BITS * LEVELS)) + 1) << (SLOT_BITS * LEVELS);
+    }
+    auto level = slot / SLOTS_PER_LEVEL;
+    auto index = static_cast<uint64_t>(slot % SLOTS_PER_LEVEL);
+    auto blockBits = SLOT_BITS * (level + 1);
+    return (m_currentTick >> blockBits << blockBits) | (index << (SLOT_BITS * level));
+}
+
+/**
+ * @brief - Put timer into slot matching its expiration time point
+ */
+void TimingWheel::place(std::shared_ptr<Timer> timer) {
+    auto slot = slotOf(toTick(timer->getLatestExpirationTimePoint()));
+    auto& position = positionOf(*timer);
+    position.slot = slot;
+    position.index = m_slots[slot].size();
+    m_slots[slot].emplace_back(std::move(timer));
+    setOccupied(slot, true);
+}
+
+/**
+ * @brief - Remove timer kept at specified position of slot
+ */
+void TimingWheel::removeAt(size_t slot, size_t index) {
+    auto& timers = m_slots[slot];
+    if (index + 1 != timers.size()) {
+        timers[index] = std::move(timers.back());
+        positionOf(*timers[index]).index = index;
+    }
+    timers.pop_back();
+    if (timers.empty()) {
+        setOccupied(slot, false);
+    }
+}
+
+/**
+ * @brief - Mark slot as (non) empty in occupancy bitmap
+ */
+void TimingWheel::setOccupied(size_t slot, bool occupied) {
+    if (slot == OVERFLOW_SLOT) {
+        return;
+    }
+    auto index = slot % SLOTS_PER_LEVEL;
+    auto& word = m_occupied[slot / SLOTS_PER_LEVEL][index / WORD_BITS];
+    auto bit = uint64_t{1} << (index % WORD_BITS);
+    word = occupied ? (word | bit) : (word & ~bit);
+}
+
+/**
+ * @brief - Find first non empty slot of level, starting from index
+ * @return - Slot number, std::nullopt if there is no such slot
+ */
+std::optional<size_t> TimingWheel::findOccupied(size_t level, size_t fromIndex) const {
+    for (size_t wordIndex = fromIndex / WORD_BITS; wordIndex < WORDS_PER_LEVEL; ++wordIndex) {
+        auto word = m_occupied[level][wordIndex];
+        if (wordIndex == fromIndex / WORD_BITS) {
+            word &= ~uint64_t{0} << (fromIndex % WORD_BITS);
+        }
+        if (word != 0) {
+            return level * SLOTS_PER_LEVEL + wordIndex * WORD_BITS + static_cast<size_t>(std::countr_zero(word));
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief - Find slot containing earliest expiring timers
+ */
+std::optional<size_t> TimingWheel::findEarliestSlot() const {
+    auto slot = findOccupied(0, m_currentTick & (SLOTS_PER_LEVEL - 1));
+    for (size_t level = 1; level < LEVELS && !slot.has_value(); ++level) {
+        // Slot under cursor is always empty on higher levels, its timers were already cascaded
+        auto fromIndex = ((m_currentTick >> (SLOT_BITS * level)) & (SLOTS_PER_LEVEL - 1)) + 1;
+        if (fromIndex < SLOTS_PER_LEVEL) {
+            slot = findOccupied(level, fromIndex);
+        }
+    }
+    if (!slot.has_value() && !m_slots[OVERFLOW_SLOT].empty()) {
+        slot = OVERFLOW_SLOT;
+    }
+    return slot;
+}
+
+/**
+ * @brief - Move all timers of slot again, regarding current wheel cursor
+ */
+void TimingWheel::cascade(size_t slot) {
+    // Slots share memory resource, so their buffers may be swapped
+    std::pmr::vector<std::shared_ptr<Timer>> timers{m_slots[slot].get_allocator()};
+    timers.swap(m_slots[slot]);
+    setOccupied(slot, false);
+    for (auto& timer : timers) {
+        place(std::move(timer));
+    }
+    // Give slot its memory back, so cascading does not allocate in steady state
+    if (m_slots[slot].empty()) {
+        timers.clear();
+        m_slots[slot].swap(timers);
+    }
+}
+
+/**
+ * @brief - Move wheel cursor forward to tick, cascading passed slots
+ * @details - No timer may expire before tick
+ */
+void TimingWheel::advanceTo(uint64_t tick) {
+    while (m_currentTick < tick) {
+        uint64_t difference = m_currentTick ^ tick;
+        if ((difference >> SLOT_BITS) == 0) {
+            m_currentTick = tick;
+            break;
+        }
+
+        size_t level = 1;
+        while (level < LEVELS && (difference >> (SLOT_BITS * (level + 1))) != 0) {
+            ++level;
+        }
+        // All slots between cursor and tick are empty, jump straight to beginning of tick's slot on that level
+        m_currentTick = tick & ~((uint64_t{1} << (SLOT_BITS * level)) - 1);
+        if (level == LEVELS) {
+            cascade(OVERFLOW_SLOT);
+        } else {
+            cascade(level * SLOTS_PER_LEVEL + ((m_currentTick >> (SLOT_BITS * level)) & (SLOTS_PER_LEVEL - 1)));
+        }
+    }
+}
+
+/**
+ * @brief - Add timer to storage, timer must not be registered yet
+ * @param timer - Timer to add
+ */
+void TimingWheel::insert(std::shared_ptr<Timer> timer) {
+    if (m_size == 0) {
+        // Empty wheel catches up with current time, its cursor is never moved to expiration time point of timer
+        m_currentTick = std::max(m_currentTick, toTick(Clock::now()));
+    }
+    auto expirationTimePoint = timer->getLatestExpirationTimePoint();
+    if (m_nextExpirationKnown && (!m_nextExpiration.has_value() || expirationTimePoint < *m_nextExpiration)) {
+        m_nextExpiration = expirationTimePoint;
+    }
+    place(std::move(timer));
+    ++m_size;
+}
+
+/**
+ * @brief - Remove timer from storage
+ * @param timer - Timer to remove
+ * @return - true if timer was removed, false if it was not registered
+ */
+bool TimingWheel::erase(const std::shared_ptr<Timer>& timer) {
+    if (!contains(timer)) {
+        return false;
+    }
+    auto position = positionOf(*timer);
+    removeAt(position.slot, position.index);
+    --m_size;
+    if (m_nextExpiration == timer->getLatestExpirationTimePoint()) {
+        m_nextExpirationKnown = false;
+    }
+    return true;
+}
+
+/**
+ * @brief - Remove all timers matching predicate
+ * @param predicate - Predicate selecting timers to remove
+ * @return - Number of removed timers
+ */
+size_t TimingWheel::eraseIf(bool (*predicate)(Timer&)) {
+    size_t erased{};
+    for (size_t slot = 0; slot <= OVERFLOW_SLOT; ++slot) {
+        auto& timers = m_slots[slot];
+        for (auto index = timers.size(); index > 0; --index) {
+            if (predicate(*timers[index - 1])) {
+                removeAt(slot, index - 1);
+                ++erased;
+            }
+        }
+    }
+    m_size -= erased;
+    if (erased > 0) {
+        m_nextExpirationKnown = false;
+    }
+    return erased;
+}
+
+/**
+ * @brief - Check if timer is stored
+ * @param timer - Timer to check
+ * @return - true if timer is stored, false otherwise
+ */
+bool TimingWheel::contains(const std::shared_ptr<Timer>& timer) const {
+    auto position = positionOf(*timer);
+    return position.slot <= OVERFLOW_SLOT && position.index < m_slots[position.slot].size() &&
+           m_slots[position.slot][position.index] == timer;
+}
+
+/**
+ * @brief - Get number of stored timers
+ * @return - number of timers
+ */
+size_t TimingWheel::size() const { return m_size; }
+
+/**
+ * @brief - Get closest expiration time point of stored timers
+ * @return - Closest expiration time point, std::nullopt if storage is empty
+ */
+std::optional<Clock::time_point> TimingWheel::nextExpirationTimePoint() {
+    if (m_nextExpirationKnown) {
+        return m_nextExpiration;
+    }
+    // Slot is scanned only once after its earliest timer was removed, cursor is not moved
+    m_nextExpiration.reset();
+    if (auto slot = findEarliestSlot(); slot.has_value()) {
+        const auto& timers = m_slots[*slot];
+        m_nextExpiration = std::min_element(std::begin(timers), std::end(timers), [](const auto& first, const auto& second) {
+                               return first->getLatestExpirationTimePoint() < second->getLatestExpirationTimePoint();
+                           })->get()->getLatestExpirationTimePoint();
+    }
+    m_nextExpirationKnown = true;
+    return m_nextExpiration;
+}
+
+/**
+ * @brief - Append all timers expiring exactly at specified time point
+ * @param timePoint - Time point
+ * @param expiredTimers - Output list
+ */
+void TimingWheel::collectExpiringAt(Clock::time_point timePoint, std::pmr::list<std::shared_ptr<Timer>>& expiredTimers) {
+    for (const auto& timer : m_slots[slotOf(toTick(timePoint))]) {
+        if (timer->getLatestExpirationTimePoint() == timePoint) {
+            expiredTimers.emplace_back(timer);
+        }
+    }
+}
+
+/**
+ * @brief - Remove timers of slot under cursor, expiring not later than time point
+ * @return - true if slot under cursor is empty afterwards
+ */
+bool TimingWheel::extractCurrentSlot(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) {
+    auto slot = static_cast<size_t>(m_currentTick & (SLOTS_PER_LEVEL - 1));
+    auto& timers = m_slots[slot];
+    auto firstExpired = static_cast<std::ptrdiff_t>(expiredTimers.size());
+    for (auto index = timers.size(); index > 0; --index) {
+        if (!(timePoint < timers[index - 1]->getLatestExpirationTimePoint())) {
+            expiredTimers.emplace_back(std::move(timers[index - 1]));
+            removeAt(slot, index - 1);
+            --m_size;
+        }
+    }
+    if (static_cast<std::ptrdiff_t>(expiredTimers.size()) != firstExpired) {
+        m_nextExpirationKnown = false;
+        // Slot keeps whole tick unordered, so only timers of single tick are sorted to extract them in order of expiration
+        std::sort(std::begin(expiredTimers) + firstExpired, std::end(expiredTimers),
+                  [](const std::shared_ptr<Timer>& first, const std::shared_ptr<Timer>& second) {
+                      return first->getLatestExpirationTimePoint() < second->getLatestExpirationTimePoint();
+                  });
+    }
+    return timers.empty();
+}
+
+/**
+ * @brief - Remove all timers expiring not later than specified time point, appending them to output vector
+ * @details - Cursor visits only occupied slots up to tick of time point, cascading higher levels on its way,
+ *            and stays at that tick afterwards
+ * @param timePoint - Time point
+ * @param expiredTimers - Output vector
+ */
+void TimingWheel::extractExpired(Clock::time_point timePoint, std::vector<std::shared_ptr<Timer>>& expiredTimers) {
+    auto tick = toTick(timePoint);
+    // Timers left in slot under cursor expire later within the same tick, so nothing else expired yet
+    while (extractCurrentSlot(timePoint, expiredTimers)) {
+        auto slot = findEarliestSlot();
+        if (!slot.has_value() || firstTickOf(*slot) > tick) {
+            break;
+        }
+        advanceTo(firstTickOf(*slot));
+    }
+    advanceTo(tick);
+}
+
+} // namespace Timers